@@ -22,6 +22,7 @@ $(TEST_OUTPUT)_SRC := \
 	$(QUANTUM_PATH)/keymap_introspection.c \
 	tests/test_common/matrix.c \
 	tests/test_common/pointing_device_driver.c \
+	tests/test_common/test_painter_device.c \
 	tests/test_common/test_driver.cpp \
 	tests/test_common/keyboard_report_util.cpp \
 	tests/test_common/mouse_report_util.cpp \
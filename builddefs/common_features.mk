@@ -133,8 +133,14 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         OPT_DEFS += -DPOINTING_DEVICE_ENABLE
         MOUSE_ENABLE := yes
         VPATH += $(QUANTUM_DIR)/pointing_device
+        POST_CONFIG_H += $(QUANTUM_DIR)/pointing_device/post_config.h
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_sampler.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_subpixel.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_accel.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_kinetic.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_touch.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -580,6 +586,13 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     endif
 endif
 
+# Counts the bursts and bytes written by the LED drivers using the dirty-span layer
+LED_DIRTY_SPAN_STATS ?= no
+ifeq ($(strip $(LED_DIRTY_SPAN_STATS)), yes)
+    OPT_DEFS += -DLED_DIRTY_SPAN_STATS
+    SRC += $(DRIVER_PATH)/led/led_dirty_span.c
+endif
+
 VARIABLE_TRACE ?= no
 ifneq ($(strip $(VARIABLE_TRACE)),no)
     SRC += $(QUANTUM_DIR)/variable_trace.c
@@ -18,6 +18,7 @@
 #include "aw20216s.h"
 #include "wait.h"
 #include "spi_master.h"
+#include "led/led_dirty_span.h"
 
 #define AW20216S_PWM_REGISTER_COUNT 216
 
@@ -48,11 +49,13 @@
 typedef struct aw20216s_driver_t {
     uint8_t pwm_buffer[AW20216S_PWM_REGISTER_COUNT];
     bool    pwm_buffer_dirty;
+    uint8_t pwm_dirty[LED_DIRTY_SPAN_BITMAP_SIZE(AW20216S_PWM_REGISTER_COUNT)];
 } PACKED aw20216s_driver_t;
 
 aw20216s_driver_t driver_buffers[AW20216S_DRIVER_COUNT] = {{
     .pwm_buffer       = {0},
     .pwm_buffer_dirty = false,
+    .pwm_dirty        = {0},
 }};
 
 bool aw20216s_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
@@ -148,6 +151,9 @@ void aw20216s_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     driver_buffers[led.driver].pwm_buffer[led.g] = green;
     driver_buffers[led.driver].pwm_buffer[led.b] = blue;
     driver_buffers[led.driver].pwm_buffer_dirty  = true;
+    led_dirty_span_mark(driver_buffers[led.driver].pwm_dirty, led.r);
+    led_dirty_span_mark(driver_buffers[led.driver].pwm_dirty, led.g);
+    led_dirty_span_mark(driver_buffers[led.driver].pwm_dirty, led.b);
 }
 
 void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -158,7 +164,14 @@ void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 
 void aw20216s_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, 0, driver_buffers[index].pwm_buffer, AW20216S_PWM_REGISTER_COUNT);
+        // Transmit only the changed PWM registers, one chip select per burst
+        uint16_t i = 0;
+        uint8_t  length;
+
+        while (led_dirty_span_next(driver_buffers[index].pwm_dirty, AW20216S_PWM_REGISTER_COUNT, &i, &length, AW20216S_PWM_REGISTER_COUNT)) {
+            aw20216s_write(cs_pin, AW20216S_PAGE_PWM, i, driver_buffers[index].pwm_buffer + i, length);
+            i += length;
+        }
         driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
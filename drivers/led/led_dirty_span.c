@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "led_dirty_span.h"
+
+#ifdef LED_DIRTY_SPAN_STATS
+led_dirty_span_stats_t led_dirty_span_stats;
+#endif
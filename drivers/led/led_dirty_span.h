@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bytes each burst costs on top of its data: the device address (or SPI
+// command) byte and the start register.
+#ifndef LED_DIRTY_SPAN_BURST_OVERHEAD
+#    define LED_DIRTY_SPAN_BURST_OVERHEAD 2
+#endif
+
+// Clean registers that may be rewritten to join two dirty runs into a single
+// burst. Past this it is cheaper to start a new burst.
+#ifndef LED_DIRTY_SPAN_MAX_GAP
+#    define LED_DIRTY_SPAN_MAX_GAP LED_DIRTY_SPAN_BURST_OVERHEAD
+#endif
+
+#define LED_DIRTY_SPAN_BITMAP_SIZE(count) (((count) + 7) / 8)
+
+#ifdef LED_DIRTY_SPAN_STATS
+typedef struct {
+    uint32_t bursts; // auto-increment writes started
+    uint32_t bytes;  // bytes put on the bus, including per-burst overhead
+} led_dirty_span_stats_t;
+
+// Shared by every driver using the dirty-span layer, see led_dirty_span.c
+extern led_dirty_span_stats_t led_dirty_span_stats;
+#endif
+
+static inline bool led_dirty_span_is_dirty(const uint8_t *dirty, uint16_t reg) {
+    return dirty[reg / 8] & (1 << (reg % 8));
+}
+
+static inline void led_dirty_span_mark(uint8_t *dirty, uint16_t reg) {
+    dirty[reg / 8] |= (1 << (reg % 8));
+}
+
+static inline void led_dirty_span_mark_all(uint8_t *dirty, uint16_t count) {
+    for (uint16_t i = 0; i < LED_DIRTY_SPAN_BITMAP_SIZE(count); i++) {
+        dirty[i] = 0xFF;
+    }
+}
+
+/**
+ * \brief Find the next run of registers that need writing, and mark it clean.
+ *
+ * Dirty registers separated by no more than `LED_DIRTY_SPAN_MAX_GAP` clean
+ * ones are coalesced into one span, up to `max_length` registers long.
+ *
+ * \param dirty The dirty bitmap, one bit per register.
+ * \param count The number of registers tracked by the bitmap.
+ * \param start The register to start searching from. Set to the first register of the span.
+ * \param length Set to the number of registers in the span.
+ * \param max_length The longest burst the device or driver accepts.
+ *
+ * \return `true` if a span was found.
+ */
+static inline bool led_dirty_span_next(uint8_t *dirty, uint16_t count, uint16_t *start, uint8_t *length, uint8_t max_length) {
+    uint16_t reg = *start;
+
+    while (reg < count && !led_dirty_span_is_dirty(dirty, reg)) {
+        // Skip over fully clean bytes of the bitmap
+        reg = (reg % 8 == 0 && dirty[reg / 8] == 0) ? reg + 8 : reg + 1;
+    }
+    if (reg >= count) {
+        return false;
+    }
+
+    uint16_t end = reg + 1;
+    for (uint16_t next = end; next < count && next - reg < max_length && next - end <= LED_DIRTY_SPAN_MAX_GAP; next++) {
+        if (led_dirty_span_is_dirty(dirty, next)) {
+            end = next + 1;
+        }
+    }
+
+    for (uint16_t i = reg; i < end; i++) {
+        dirty[i / 8] &= ~(1 << (i % 8));
+    }
+
+    *start  = reg;
+    *length = end - reg;
+
+#ifdef LED_DIRTY_SPAN_STATS
+    led_dirty_span_stats.bursts++;
+    led_dirty_span_stats.bytes += *length + LED_DIRTY_SPAN_BURST_OVERHEAD;
+#endif
+
+    return true;
+}
@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "led/led_dirty_span.h"
+}
+
+#define REGISTER_COUNT 192
+
+class LedDirtySpan : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(dirty, 0, sizeof(dirty));
+        led_dirty_span_stats = {};
+    }
+
+    // Collects every span, the way a driver's write_pwm_buffer() walks them
+    std::vector<std::pair<uint16_t, uint8_t>> spans(uint16_t count, uint8_t max_length) {
+        std::vector<std::pair<uint16_t, uint8_t>> result;
+        uint16_t                                  i = 0;
+        uint8_t                                   length;
+
+        while (led_dirty_span_next(dirty, count, &i, &length, max_length)) {
+            result.push_back({i, length});
+            i += length;
+        }
+        return result;
+    }
+
+    uint8_t dirty[LED_DIRTY_SPAN_BITMAP_SIZE(REGISTER_COUNT)];
+};
+
+TEST_F(LedDirtySpan, CleanBufferWritesNothing) {
+    EXPECT_TRUE(spans(REGISTER_COUNT, 16).empty());
+    EXPECT_EQ(led_dirty_span_stats.bursts, 0u);
+    EXPECT_EQ(led_dirty_span_stats.bytes, 0u);
+}
+
+TEST_F(LedDirtySpan, SingleRegister) {
+    led_dirty_span_mark(dirty, 37);
+
+    auto result = spans(REGISTER_COUNT, 16);
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].first, 37);
+    EXPECT_EQ(result[0].second, 1);
+}
+
+TEST_F(LedDirtySpan, CoalescesSmallGaps) {
+    // Two clean registers between them are cheaper to rewrite than a new burst
+    led_dirty_span_mark(dirty, 10);
+    led_dirty_span_mark(dirty, 13);
+    // Three are not
+    led_dirty_span_mark(dirty, 40);
+    led_dirty_span_mark(dirty, 44);
+
+    auto result = spans(REGISTER_COUNT, 16);
+    ASSERT_EQ(result.size(), 3u);
+    EXPECT_EQ(result[0].first, 10);
+    EXPECT_EQ(result[0].second, 4);
+    EXPECT_EQ(result[1].first, 40);
+    EXPECT_EQ(result[1].second, 1);
+    EXPECT_EQ(result[2].first, 44);
+    EXPECT_EQ(result[2].second, 1);
+}
+
+TEST_F(LedDirtySpan, RespectsMaxLength) {
+    led_dirty_span_mark_all(dirty, REGISTER_COUNT);
+
+    auto result = spans(REGISTER_COUNT, 16);
+    ASSERT_EQ(result.size(), 12u);
+    for (uint8_t i = 0; i < 12; i++) {
+        EXPECT_EQ(result[i].first, i * 16);
+        EXPECT_EQ(result[i].second, 16);
+    }
+    EXPECT_EQ(led_dirty_span_stats.bytes, REGISTER_COUNT + 12 * LED_DIRTY_SPAN_BURST_OVERHEAD);
+}
+
+TEST_F(LedDirtySpan, StopsAtRegisterCount) {
+    led_dirty_span_mark_all(dirty, 143);
+
+    auto result = spans(143, 13);
+    ASSERT_EQ(result.size(), 11u);
+    EXPECT_EQ(result.back().first + result.back().second, 143);
+}
+
+TEST_F(LedDirtySpan, SpansAreMarkedClean) {
+    led_dirty_span_mark(dirty, 0);
+    led_dirty_span_mark(dirty, 100);
+    led_dirty_span_mark(dirty, REGISTER_COUNT - 1);
+
+    EXPECT_EQ(spans(REGISTER_COUNT, 16).size(), 3u);
+    EXPECT_TRUE(spans(REGISTER_COUNT, 16).empty());
+}
+
+TEST_F(LedDirtySpan, SingleLedChangeSavesBusBytes) {
+    // One RGB LED on an IS31FL3733, with its channels on separate SW rows
+    led_dirty_span_mark(dirty, 0x00 + 5);
+    led_dirty_span_mark(dirty, 0x10 + 5);
+    led_dirty_span_mark(dirty, 0x20 + 5);
+
+    spans(REGISTER_COUNT, 16);
+    EXPECT_EQ(led_dirty_span_stats.bursts, 3u);
+    EXPECT_EQ(led_dirty_span_stats.bytes, 3u * (1 + LED_DIRTY_SPAN_BURST_OVERHEAD));
+
+    // Rewriting the whole page in 16 byte bursts, as before
+    uint32_t full_page = REGISTER_COUNT + (REGISTER_COUNT / 16) * LED_DIRTY_SPAN_BURST_OVERHEAD;
+    EXPECT_LT(led_dirty_span_stats.bytes * 20, full_page);
+}
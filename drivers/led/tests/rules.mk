@@ -0,0 +1,4 @@
+led_dirty_span_DEFS := -DLED_DIRTY_SPAN_STATS
+led_dirty_span_SRC := \
+	$(DRIVER_PATH)/led/tests/led_dirty_span_tests.cpp \
+	$(DRIVER_PATH)/led/led_dirty_span.c
@@ -0,0 +1 @@
+TEST_LIST += led_dirty_span
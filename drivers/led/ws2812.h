@@ -56,6 +56,14 @@
 #    define WS2812_TRST_US 280
 #endif
 
+/*
+ * Drivers which skip flushes identical to the previous frame still resend it once every WS2812_REFRESH_MS, so LEDs
+ * which missed a frame (or were powered after it was sent) catch up. Set to 0 to send every flush.
+ */
+#ifndef WS2812_REFRESH_MS
+#    define WS2812_REFRESH_MS 1000
+#endif
+
 #if defined(RGBLIGHT_WS2812)
 #    define WS2812_LED_COUNT RGBLIGHT_LED_COUNT
 #elif defined(RGB_MATRIX_WS2812)
@@ -21,6 +21,36 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_NUM_COMPOSITORS
+/**
+ * @def This controls the maximum number of surface compositors that Quantum Painter can use at any one time.
+ */
+#    define SURFACE_NUM_COMPOSITORS 1
+#endif
+
+#ifndef SURFACE_COMPOSITOR_MAX_LAYERS
+/**
+ * @def This controls the maximum number of layers each surface compositor can stack.
+ */
+#    define SURFACE_COMPOSITOR_MAX_LAYERS 4
+#endif
+
+#ifndef SURFACE_COMPOSITOR_TILE_SIZE
+/**
+ * @def This controls the width and height, in pixels, of the tiles used by the compositor to track changed areas.
+ *      Smaller tiles track changes more accurately at the cost of RAM for the tile map.
+ */
+#    define SURFACE_COMPOSITOR_TILE_SIZE 16
+#endif
+
+#ifndef SURFACE_COMPOSITOR_MAX_TILES
+/**
+ * @def This controls the maximum number of tiles a compositor can track. The default covers a 320x240 display with
+ *      16x16 tiles.
+ */
+#    define SURFACE_COMPOSITOR_MAX_TILES 300
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -74,4 +104,91 @@ painter_device_t qp_make_rgb888_surface(uint16_t panel_width, uint16_t panel_hei
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * @typedef A handle to a surface compositor, which blends a stack of RGB565 surfaces onto a target device.
+ */
+typedef const void *painter_compositor_t;
+
+/**
+ * Factory method for a surface compositor.
+ *
+ * @param width[in] the width of the composed output
+ * @param height[in] the height of the composed output
+ * @return the compositor handle used with all other compositor APIs
+ * @return NULL if no compositor slots are free, or the output is too large for SURFACE_COMPOSITOR_MAX_TILES
+ */
+painter_compositor_t qp_make_surface_compositor(uint16_t width, uint16_t height);
+
+/**
+ * Adds an RGB565 surface to the top of the compositor's layer stack.
+ *
+ * @param compositor[in] the compositor to add the layer to
+ * @param surface[in] the RGB565 surface holding the layer's contents
+ * @param x[in] the x-location of the layer within the composed output
+ * @param y[in] the y-location of the layer within the composed output
+ * @return the index of the new layer
+ * @return -1 if the layer could not be added
+ */
+int8_t qp_compositor_add_layer(painter_compositor_t compositor, painter_device_t surface, int16_t x, int16_t y);
+
+/**
+ * Moves a layer within the composed output.
+ *
+ * @param compositor[in] the compositor owning the layer
+ * @param layer[in] the index of the layer, as returned by \ref qp_compositor_add_layer
+ * @param x[in] the new x-location of the layer
+ * @param y[in] the new y-location of the layer
+ * @return whether the layer was updated
+ */
+bool qp_compositor_set_layer_position(painter_compositor_t compositor, int8_t layer, int16_t x, int16_t y);
+
+/**
+ * Shows or hides a layer.
+ *
+ * @param compositor[in] the compositor owning the layer
+ * @param layer[in] the index of the layer, as returned by \ref qp_compositor_add_layer
+ * @param visible[in] whether the layer should be composed
+ * @return whether the layer was updated
+ */
+bool qp_compositor_set_layer_visible(painter_compositor_t compositor, int8_t layer, bool visible);
+
+/**
+ * Sets the opacity of a layer.
+ *
+ * @param compositor[in] the compositor owning the layer
+ * @param layer[in] the index of the layer, as returned by \ref qp_compositor_add_layer
+ * @param alpha[in] the opacity of the layer, from 0 (invisible) to 255 (opaque)
+ * @return whether the layer was updated
+ */
+bool qp_compositor_set_layer_alpha(painter_compositor_t compositor, int8_t layer, uint8_t alpha);
+
+/**
+ * Sets the color treated as fully transparent within a layer.
+ *
+ * @param compositor[in] the compositor owning the layer
+ * @param layer[in] the index of the layer, as returned by \ref qp_compositor_add_layer
+ * @param enabled[in] whether pixels matching the color are skipped
+ * @param hue[in] the hue of the transparent color
+ * @param sat[in] the saturation of the transparent color
+ * @param val[in] the value of the transparent color
+ * @return whether the layer was updated
+ */
+bool qp_compositor_set_layer_transparent_color(painter_compositor_t compositor, int8_t layer, bool enabled, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Composes all layers changed since the last call, and transfers the result to the target device.
+ *
+ * Only tiles touched by layer drawing operations or layer property changes are recomposed, and the bounding box of
+ * those tiles is sent to the target in a single transfer. After successful completion, the dirty regions of all layer
+ * surfaces are reset.
+ *
+ * @param compositor[in] the compositor to draw
+ * @param target[in] the target device to draw into, which must be a 16bpp RGB565 device
+ * @param x[in] the x-location of the composed output on the target
+ * @param y[in] the y-location of the composed output on the target
+ * @param entire_output[in] whether the entire output should be drawn, instead of just the changed tiles
+ * @return whether the draw operation completed successfully
+ */
+bool qp_compositor_draw(painter_compositor_t compositor, painter_device_t target, uint16_t x, uint16_t y, bool entire_output);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
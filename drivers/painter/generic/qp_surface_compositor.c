@@ -0,0 +1,359 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+
+#    include "color.h"
+#    include "qp_draw.h"
+#    include "qp_surface_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compositor storage
+
+typedef struct surface_compositor_layer_t {
+    surface_painter_device_t *surface;
+    int16_t                   x;
+    int16_t                   y;
+    bool                      visible;
+    uint8_t                   alpha;
+    bool                      has_transparent_color;
+    uint16_t                  transparent_color; // native (byte-swapped) RGB565
+} surface_compositor_layer_t;
+
+typedef struct surface_compositor_t {
+    bool                       in_use;
+    uint16_t                   width;
+    uint16_t                   height;
+    uint16_t                   tiles_x;
+    uint16_t                   tiles_y;
+    uint8_t                    layer_count;
+    surface_compositor_layer_t layers[SURFACE_COMPOSITOR_MAX_LAYERS];
+    uint8_t                    dirty_tiles[(SURFACE_COMPOSITOR_MAX_TILES + 7) / 8];
+} surface_compositor_t;
+
+static surface_compositor_t surface_compositors[SURFACE_NUM_COMPOSITORS] = {0};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+static surface_compositor_layer_t *compositor_get_layer(surface_compositor_t *comp, int8_t layer) {
+    if (!comp || !comp->in_use || layer < 0 || layer >= comp->layer_count) {
+        qp_dprintf("qp_compositor: fail (invalid compositor or layer %d)\n", (int)layer);
+        return NULL;
+    }
+    return &comp->layers[layer];
+}
+
+// Marks all tiles overlapping the supplied rectangle, given in output coordinates, as needing recomposition
+static void compositor_mark_rect(surface_compositor_t *comp, int32_t l, int32_t t, int32_t r, int32_t b) {
+    // Clip to the output
+    if (l < 0) l = 0;
+    if (t < 0) t = 0;
+    if (r > comp->width - 1) r = comp->width - 1;
+    if (b > comp->height - 1) b = comp->height - 1;
+    if (l > r || t > b) {
+        return;
+    }
+
+    for (uint16_t ty = t / SURFACE_COMPOSITOR_TILE_SIZE; ty <= b / SURFACE_COMPOSITOR_TILE_SIZE; ++ty) {
+        for (uint16_t tx = l / SURFACE_COMPOSITOR_TILE_SIZE; tx <= r / SURFACE_COMPOSITOR_TILE_SIZE; ++tx) {
+            uint16_t tile = ty * comp->tiles_x + tx;
+            comp->dirty_tiles[tile / 8] |= (1 << (tile % 8));
+        }
+    }
+}
+
+static void compositor_mark_layer_bounds(surface_compositor_t *comp, surface_compositor_layer_t *layer) {
+    compositor_mark_rect(comp, layer->x, layer->y, (int32_t)layer->x + layer->surface->base.panel_width - 1, (int32_t)layer->y + layer->surface->base.panel_height - 1);
+}
+
+static inline uint16_t blend_rgb565_swapped(uint16_t dst, uint16_t src, uint16_t alpha) {
+    // alpha is in the range [0,256], values are byte-swapped as per the RGB565 surface
+    dst = __builtin_bswap16(dst);
+    src = __builtin_bswap16(src);
+
+    uint16_t inv = 256 - alpha;
+    uint16_t r   = (((src >> 11) & 0x1F) * alpha + ((dst >> 11) & 0x1F) * inv) >> 8;
+    uint16_t g   = (((src >> 5) & 0x3F) * alpha + ((dst >> 5) & 0x3F) * inv) >> 8;
+    uint16_t b   = ((src & 0x1F) * alpha + (dst & 0x1F) * inv) >> 8;
+
+    return __builtin_bswap16((r << 11) | (g << 5) | b);
+}
+
+// Composes a single row span of the output, writing the native pixels into the supplied buffer
+static void compositor_compose_span(surface_compositor_t *comp, uint16_t y, uint16_t l, uint16_t r, uint16_t *out) {
+    uint16_t count = r - l + 1;
+    memset(out, 0, count * sizeof(uint16_t));
+
+    for (uint8_t i = 0; i < comp->layer_count; ++i) {
+        surface_compositor_layer_t *layer = &comp->layers[i];
+        if (!layer->visible || layer->alpha == 0) {
+            continue;
+        }
+
+        // Skip layers that don't intersect this row
+        int32_t ly = (int32_t)y - layer->y;
+        if (ly < 0 || ly >= layer->surface->base.panel_height) {
+            continue;
+        }
+
+        // Work out the horizontal overlap between the layer and the span
+        int32_t lw    = layer->surface->base.panel_width;
+        int32_t start = MAX((int32_t)l, (int32_t)layer->x);
+        int32_t end   = MIN((int32_t)r, (int32_t)layer->x + lw - 1);
+        if (start > end) {
+            continue;
+        }
+
+        const uint16_t *src   = &layer->surface->u16buffer[ly * lw + (start - layer->x)];
+        uint16_t       *dst   = &out[start - l];
+        uint16_t        alpha = layer->alpha + (layer->alpha >> 7); // map [0,255] to [0,256]
+        for (int32_t n = 0; n <= end - start; ++n) {
+            uint16_t px = src[n];
+            if (layer->has_transparent_color && px == layer->transparent_color) {
+                continue;
+            }
+            dst[n] = (alpha == 256) ? px : blend_rgb565_swapped(dst[n], px, alpha);
+        }
+    }
+}
+
+// Checks that the target accepts the same native pixel format as the layers, i.e. byte-swapped RGB565
+static bool compositor_target_is_rgb565(painter_driver_t *target_driver) {
+    if (target_driver->native_bits_per_pixel != 16) {
+        return false;
+    }
+
+    // Matching bit depth alone isn't enough -- run a few probe colors through both converters and compare the results
+    static const hsv_t probes[] = {{0, 255, 255}, {85, 255, 255}, {170, 255, 255}, {0, 0, 255}, {30, 200, 128}};
+    qp_pixel_t         expected[ARRAY_SIZE(probes)];
+    qp_pixel_t         actual[ARRAY_SIZE(probes)];
+    for (uint8_t i = 0; i < ARRAY_SIZE(probes); ++i) {
+        expected[i].dummy  = 0;
+        actual[i].dummy    = 0;
+        expected[i].hsv888 = probes[i];
+        actual[i].hsv888   = probes[i];
+    }
+
+    if (!rgb565_surface_driver_vtable.base.palette_convert(NULL, ARRAY_SIZE(probes), expected) || !target_driver->driver_vtable->palette_convert((painter_device_t)target_driver, ARRAY_SIZE(probes), actual)) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(probes); ++i) {
+        if (expected[i].rgb565 != actual[i].rgb565) {
+            return false;
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compositor API
+
+painter_compositor_t qp_make_surface_compositor(uint16_t width, uint16_t height) {
+    uint16_t tiles_x = (width + SURFACE_COMPOSITOR_TILE_SIZE - 1) / SURFACE_COMPOSITOR_TILE_SIZE;
+    uint16_t tiles_y = (height + SURFACE_COMPOSITOR_TILE_SIZE - 1) / SURFACE_COMPOSITOR_TILE_SIZE;
+    if (width == 0 || height == 0 || ((uint32_t)tiles_x * tiles_y) > SURFACE_COMPOSITOR_MAX_TILES) {
+        qp_dprintf("qp_make_surface_compositor: fail (output size %dx%d needs too many tiles)\n", (int)width, (int)height);
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < SURFACE_NUM_COMPOSITORS; ++i) {
+        surface_compositor_t *comp = &surface_compositors[i];
+        if (!comp->in_use) {
+            memset(comp, 0, sizeof(surface_compositor_t));
+            comp->in_use  = true;
+            comp->width   = width;
+            comp->height  = height;
+            comp->tiles_x = tiles_x;
+            comp->tiles_y = tiles_y;
+            compositor_mark_rect(comp, 0, 0, width - 1, height - 1);
+            return (painter_compositor_t)comp;
+        }
+    }
+
+    qp_dprintf("qp_make_surface_compositor: fail (no free slot)\n");
+    return NULL;
+}
+
+int8_t qp_compositor_add_layer(painter_compositor_t compositor, painter_device_t surface, int16_t x, int16_t y) {
+    surface_compositor_t *comp   = (surface_compositor_t *)compositor;
+    painter_driver_t     *driver = (painter_driver_t *)surface;
+    if (!comp || !comp->in_use || comp->layer_count >= SURFACE_COMPOSITOR_MAX_LAYERS) {
+        qp_dprintf("qp_compositor_add_layer: fail (invalid compositor or no free layer)\n");
+        return -1;
+    }
+
+    // Only RGB565 surfaces can be composed
+    if (!driver || driver->driver_vtable != (const painter_driver_vtable_t *)&rgb565_surface_driver_vtable) {
+        qp_dprintf("qp_compositor_add_layer: fail (layer is not an RGB565 surface)\n");
+        return -1;
+    }
+
+    surface_compositor_layer_t *layer = &comp->layers[comp->layer_count];
+    layer->surface                    = (surface_painter_device_t *)driver;
+    layer->x                          = x;
+    layer->y                          = y;
+    layer->visible                    = true;
+    layer->alpha                      = 255;
+    layer->has_transparent_color      = false;
+    compositor_mark_layer_bounds(comp, layer);
+    return comp->layer_count++;
+}
+
+bool qp_compositor_set_layer_position(painter_compositor_t compositor, int8_t layer_index, int16_t x, int16_t y) {
+    surface_compositor_t       *comp  = (surface_compositor_t *)compositor;
+    surface_compositor_layer_t *layer = compositor_get_layer(comp, layer_index);
+    if (!layer) {
+        return false;
+    }
+
+    if (layer->x != x || layer->y != y) {
+        // Both the uncovered and newly-covered areas need recomposing
+        compositor_mark_layer_bounds(comp, layer);
+        layer->x = x;
+        layer->y = y;
+        compositor_mark_layer_bounds(comp, layer);
+    }
+    return true;
+}
+
+bool qp_compositor_set_layer_visible(painter_compositor_t compositor, int8_t layer_index, bool visible) {
+    surface_compositor_t       *comp  = (surface_compositor_t *)compositor;
+    surface_compositor_layer_t *layer = compositor_get_layer(comp, layer_index);
+    if (!layer) {
+        return false;
+    }
+
+    if (layer->visible != visible) {
+        layer->visible = visible;
+        compositor_mark_layer_bounds(comp, layer);
+    }
+    return true;
+}
+
+bool qp_compositor_set_layer_alpha(painter_compositor_t compositor, int8_t layer_index, uint8_t alpha) {
+    surface_compositor_t       *comp  = (surface_compositor_t *)compositor;
+    surface_compositor_layer_t *layer = compositor_get_layer(comp, layer_index);
+    if (!layer) {
+        return false;
+    }
+
+    if (layer->alpha != alpha) {
+        layer->alpha = alpha;
+        compositor_mark_layer_bounds(comp, layer);
+    }
+    return true;
+}
+
+bool qp_compositor_set_layer_transparent_color(painter_compositor_t compositor, int8_t layer_index, bool enabled, uint8_t hue, uint8_t sat, uint8_t val) {
+    surface_compositor_t       *comp  = (surface_compositor_t *)compositor;
+    surface_compositor_layer_t *layer = compositor_get_layer(comp, layer_index);
+    if (!layer) {
+        return false;
+    }
+
+    // Convert the same way as the RGB565 surface's palette conversion, so drawn pixels match exactly
+    qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
+    layer->surface->base.driver_vtable->palette_convert((painter_device_t)layer->surface, 1, &color);
+
+    layer->has_transparent_color = enabled;
+    layer->transparent_color     = color.rgb565;
+    compositor_mark_layer_bounds(comp, layer);
+    return true;
+}
+
+bool qp_compositor_draw(painter_compositor_t compositor, painter_device_t target, uint16_t x, uint16_t y, bool entire_output) {
+    surface_compositor_t *comp          = (surface_compositor_t *)compositor;
+    painter_driver_t     *target_driver = (painter_driver_t *)target;
+    if (!comp || !comp->in_use) {
+        qp_dprintf("qp_compositor_draw: fail (invalid compositor)\n");
+        return false;
+    }
+
+    if (!target_driver || !compositor_target_is_rgb565(target_driver)) {
+        qp_dprintf("qp_compositor_draw: fail (target is not RGB565)\n");
+        return false;
+    }
+
+    // Pick up anything drawn to the layers since the last frame
+    for (uint8_t i = 0; i < comp->layer_count; ++i) {
+        surface_compositor_layer_t *layer = &comp->layers[i];
+        if (layer->surface->dirty.is_dirty) {
+            if (layer->visible) {
+                compositor_mark_rect(comp, (int32_t)layer->x + layer->surface->dirty.l, (int32_t)layer->y + layer->surface->dirty.t, (int32_t)layer->x + layer->surface->dirty.r, (int32_t)layer->y + layer->surface->dirty.b);
+            }
+            qp_flush((painter_device_t)layer->surface);
+        }
+    }
+
+    if (entire_output) {
+        compositor_mark_rect(comp, 0, 0, comp->width - 1, comp->height - 1);
+    }
+
+    // Work out the bounding box of the tiles requiring recomposition
+    uint16_t tl = UINT16_MAX, tt = UINT16_MAX, tr = 0, tb = 0;
+    for (uint16_t ty = 0; ty < comp->tiles_y; ++ty) {
+        for (uint16_t tx = 0; tx < comp->tiles_x; ++tx) {
+            uint16_t tile = ty * comp->tiles_x + tx;
+            if (comp->dirty_tiles[tile / 8] & (1 << (tile % 8))) {
+                tl = MIN(tl, tx);
+                tt = MIN(tt, ty);
+                tr = MAX(tr, tx);
+                tb = MAX(tb, ty);
+            }
+        }
+    }
+
+    // If nothing changed... we're done.
+    if (tl == UINT16_MAX) {
+        qp_dprintf("qp_compositor_draw: ok (not dirty, skipping)\n");
+        return true;
+    }
+
+    uint16_t l = tl * SURFACE_COMPOSITOR_TILE_SIZE;
+    uint16_t t = tt * SURFACE_COMPOSITOR_TILE_SIZE;
+    uint16_t r = MIN((tr + 1) * SURFACE_COMPOSITOR_TILE_SIZE, comp->width) - 1;
+    uint16_t b = MIN((tb + 1) * SURFACE_COMPOSITOR_TILE_SIZE, comp->height) - 1;
+
+    // Set the target drawing area, once for the whole transfer
+    if (!qp_viewport(target, x + l, y + t, x + r, y + b)) {
+        qp_dprintf("qp_compositor_draw: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Compose row by row into the global pixdata buffer, streaming it out whenever it fills up
+    uint32_t  buffer_pixels = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / 16;
+    uint32_t  pixel_counter = 0;
+    uint16_t *target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
+    for (uint16_t row = t; row <= b; ++row) {
+        uint16_t span_l = l;
+        while (span_l <= r) {
+            // Compose as much of the row as fits in the remaining buffer space
+            uint16_t span_r = MIN((uint32_t)r, span_l + (buffer_pixels - pixel_counter) - 1);
+            compositor_compose_span(comp, row, span_l, span_r, &target_buffer[pixel_counter]);
+            pixel_counter += span_r - span_l + 1;
+            span_l = span_r + 1;
+
+            if (pixel_counter == buffer_pixels) {
+                if (!qp_pixdata(target, qp_internal_global_pixdata_buffer, pixel_counter)) {
+                    qp_dprintf("qp_compositor_draw: fail (could not stream pixdata to target)\n");
+                    return false;
+                }
+                pixel_counter = 0;
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (pixel_counter > 0 && !qp_pixdata(target, qp_internal_global_pixdata_buffer, pixel_counter)) {
+        qp_dprintf("qp_compositor_draw: fail (could not stream pixdata to target)\n");
+        return false;
+    }
+
+    memset(comp->dirty_tiles, 0, sizeof(comp->dirty_tiles));
+    qp_dprintf("qp_compositor_draw: ok\n");
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -82,6 +82,9 @@ painter_device_t qp_make_mono1bpp_surface_advanced(surface_painter_device_t *dev
 // Driver storage
 extern surface_painter_device_t surface_drivers[SURFACE_NUM_DEVICES];
 
+// Driver vtables, used to determine surface types
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+
 // Surface common APIs
 bool qp_surface_init(painter_device_t device, painter_rotation_t rotation);
 bool qp_surface_power(painter_device_t device, bool power_on);
@@ -4,6 +4,7 @@
 
 #include "azoteq_iqs5xx.h"
 #include "pointing_device_internal.h"
+#include "timer.h"
 #include "wait.h"
 
 #ifndef AZOTEQ_IQS5XX_ADDRESS
@@ -26,18 +27,23 @@
 #define AZOTEQ_IQS5XX_REG_SINGLE_FINGER_GESTURES 0x06B7
 #define AZOTEQ_IQS5XX_REG_END_COMMS 0xEEEE
 
-// Gesture configuration
+// Gesture configuration, the gestures of the trackpad are replaced by the gesture engine when it is enabled
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+#    define AZOTEQ_IQS5XX_GESTURE_DEFAULT false
+#else
+#    define AZOTEQ_IQS5XX_GESTURE_DEFAULT true
+#endif
 #ifndef AZOTEQ_IQS5XX_TAP_ENABLE
-#    define AZOTEQ_IQS5XX_TAP_ENABLE true
+#    define AZOTEQ_IQS5XX_TAP_ENABLE AZOTEQ_IQS5XX_GESTURE_DEFAULT
 #endif
 #ifndef AZOTEQ_IQS5XX_PRESS_AND_HOLD_ENABLE
 #    define AZOTEQ_IQS5XX_PRESS_AND_HOLD_ENABLE false
 #endif
 #ifndef AZOTEQ_IQS5XX_TWO_FINGER_TAP_ENABLE
-#    define AZOTEQ_IQS5XX_TWO_FINGER_TAP_ENABLE true
+#    define AZOTEQ_IQS5XX_TWO_FINGER_TAP_ENABLE AZOTEQ_IQS5XX_GESTURE_DEFAULT
 #endif
 #ifndef AZOTEQ_IQS5XX_SCROLL_ENABLE
-#    define AZOTEQ_IQS5XX_SCROLL_ENABLE true
+#    define AZOTEQ_IQS5XX_SCROLL_ENABLE AZOTEQ_IQS5XX_GESTURE_DEFAULT
 #endif
 #ifndef AZOTEQ_IQS5XX_SWIPE_X_ENABLE
 #    define AZOTEQ_IQS5XX_SWIPE_X_ENABLE false
@@ -115,7 +121,7 @@ static uint16_t azoteq_iqs5xx_product_number = AZOTEQ_IQS5XX_UNKNOWN;
 static struct {
     uint16_t resolution_x;
     uint16_t resolution_y;
-} azoteq_iqs5xx_device_resolution_t;
+} azoteq_iqs5xx_device_resolution_t, azoteq_iqs5xx_current_resolution;
 
 i2c_status_t azoteq_iqs5xx_end_session(void) {
     const uint8_t END_BYTE = 1; // any data
@@ -130,6 +136,16 @@ i2c_status_t azoteq_iqs5xx_get_base_data(azoteq_iqs5xx_base_data_t *base_data) {
     return status;
 }
 
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+i2c_status_t azoteq_iqs5xx_get_touch_data(azoteq_iqs5xx_touch_data_t *touch_data) {
+    i2c_status_t status = i2c_read_register16(AZOTEQ_IQS5XX_ADDRESS, AZOTEQ_IQS5XX_REG_PREVIOUS_CYCLE_TIME, (uint8_t *)touch_data, sizeof(azoteq_iqs5xx_touch_data_t), AZOTEQ_IQS5XX_TIMEOUT_MS);
+    if (status == I2C_STATUS_SUCCESS) {
+        azoteq_iqs5xx_end_session();
+    }
+    return status;
+}
+#endif
+
 i2c_status_t azoteq_iqs5xx_get_report_rate(azoteq_iqs5xx_report_rate_t *report_rate, azoteq_iqs5xx_charging_modes_t mode, bool end_session) {
     if (mode > AZOTEQ_IQS5XX_LP2) {
         pd_dprintf("IQS5XX - Invalid mode for get report rate.\n");
@@ -262,9 +278,11 @@ i2c_status_t azoteq_iqs5xx_reset_suspend(bool reset, bool suspend, bool end_sess
 
 void azoteq_iqs5xx_set_cpi(uint16_t cpi) {
     if (azoteq_iqs5xx_product_number != AZOTEQ_IQS5XX_UNKNOWN) {
-        azoteq_iqs5xx_resolution_t resolution = {0};
-        resolution.x_resolution               = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(MIN(azoteq_iqs5xx_device_resolution_t.resolution_x, AZOTEQ_IQS5XX_INCH_TO_RESOLUTION_X(cpi)));
-        resolution.y_resolution               = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(MIN(azoteq_iqs5xx_device_resolution_t.resolution_y, AZOTEQ_IQS5XX_INCH_TO_RESOLUTION_Y(cpi)));
+        azoteq_iqs5xx_resolution_t resolution         = {0};
+        azoteq_iqs5xx_current_resolution.resolution_x = MIN(azoteq_iqs5xx_device_resolution_t.resolution_x, AZOTEQ_IQS5XX_INCH_TO_RESOLUTION_X(cpi));
+        azoteq_iqs5xx_current_resolution.resolution_y = MIN(azoteq_iqs5xx_device_resolution_t.resolution_y, AZOTEQ_IQS5XX_INCH_TO_RESOLUTION_Y(cpi));
+        resolution.x_resolution                       = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(azoteq_iqs5xx_current_resolution.resolution_x);
+        resolution.y_resolution                       = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(azoteq_iqs5xx_current_resolution.resolution_y);
         i2c_write_register16(AZOTEQ_IQS5XX_ADDRESS, AZOTEQ_IQS5XX_REG_X_RESOLUTION, (uint8_t *)&resolution, sizeof(azoteq_iqs5xx_resolution_t), AZOTEQ_IQS5XX_TIMEOUT_MS);
     }
 }
@@ -317,6 +335,7 @@ void azoteq_iqs5xx_setup_resolution(void) {
 #ifdef AZOTEQ_IQS5XX_RESOLUTION_Y
     azoteq_iqs5xx_device_resolution_t.resolution_y = AZOTEQ_IQS5XX_RESOLUTION_Y;
 #endif
+    azoteq_iqs5xx_current_resolution = azoteq_iqs5xx_device_resolution_t;
 }
 
 static i2c_status_t azoteq_iqs5xx_init_status = 1;
@@ -353,6 +372,41 @@ bool azoteq_iqs5xx_init(void) {
     return azoteq_iqs5xx_init_status == I2C_STATUS_SUCCESS;
 };
 
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+report_mouse_t azoteq_iqs5xx_get_report(report_mouse_t mouse_report) {
+    azoteq_iqs5xx_touch_data_t touch_data = {0};
+    i2c_status_t               status     = azoteq_iqs5xx_get_touch_data(&touch_data);
+
+    if (status != I2C_STATUS_SUCCESS) {
+        pd_dprintf("IQS5XX - get touch data failed, i2c status: %d \n", status);
+        return (report_mouse_t){0};
+    }
+
+    // Slots are indexed by finger, so a finger keeps its id while it stays down
+    pointing_device_touch_frame_t frame = {
+        .time   = timer_read(),
+        .width  = azoteq_iqs5xx_current_resolution.resolution_x,
+        .height = azoteq_iqs5xx_current_resolution.resolution_y,
+    };
+    for (uint8_t i = 0; i < AZOTEQ_IQS5XX_MAX_FINGERS && frame.count < POINTING_DEVICE_TOUCH_MAX_CONTACTS; i++) {
+        const azoteq_iqs5xx_finger_t *finger   = &touch_data.fingers[i];
+        uint16_t                      strength = AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(finger->strength.h, finger->strength.l);
+        if (strength) {
+            frame.contacts[frame.count++] = (pointing_device_touch_contact_t){
+                .id       = i,
+                .x        = AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(finger->x.h, finger->x.l),
+                .y        = AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(finger->y.h, finger->y.l),
+                .pressure = MIN(strength, UINT8_MAX),
+            };
+        }
+    }
+#    ifdef POINTING_DEVICE_KINETIC_ENABLE
+    pointing_device_kinetic_set_contact(frame.count > 0);
+#    endif
+
+    return pointing_device_touch_process(&frame, (report_mouse_t){0});
+}
+#else
 report_mouse_t azoteq_iqs5xx_get_report(report_mouse_t mouse_report) {
     report_mouse_t temp_report = {0};
 
@@ -361,6 +415,9 @@ report_mouse_t azoteq_iqs5xx_get_report(report_mouse_t mouse_report) {
     bool                      ignore_movement = false;
 
     if (status == I2C_STATUS_SUCCESS) {
+#ifdef POINTING_DEVICE_KINETIC_ENABLE
+        pointing_device_kinetic_set_contact(base_data.number_of_fingers > 0);
+#endif
 #ifdef POINTING_DEVICE_DEBUG
         if (base_data.previous_cycle_time > AZOTEQ_IQS5XX_REPORT_RATE) {
             pd_dprintf("IQS5XX - previous cycle time missed, took: %dms\n", base_data.previous_cycle_time);
@@ -412,3 +469,4 @@ report_mouse_t azoteq_iqs5xx_get_report(report_mouse_t mouse_report) {
 
     return temp_report;
 }
+#endif
@@ -90,6 +90,29 @@ typedef struct {
 
 STATIC_ASSERT(sizeof(azoteq_iqs5xx_report_data_t) == 5, "azoteq_iqs5xx_report_data_t should be 5 bytes");
 
+typedef struct {
+    uint8_t h : 8;
+    uint8_t l : 8;
+} azoteq_iqs5xx_absolute_xy_t;
+
+typedef struct PACKED {
+    azoteq_iqs5xx_absolute_xy_t x;
+    azoteq_iqs5xx_absolute_xy_t y;
+    azoteq_iqs5xx_absolute_xy_t strength; // 0 if the finger is not on the trackpad
+    uint8_t                     area;
+} azoteq_iqs5xx_finger_t;
+
+STATIC_ASSERT(sizeof(azoteq_iqs5xx_finger_t) == 7, "azoteq_iqs5xx_finger_t should be 7 bytes");
+
+#define AZOTEQ_IQS5XX_MAX_FINGERS 5
+
+typedef struct PACKED {
+    azoteq_iqs5xx_base_data_t base_data;
+    azoteq_iqs5xx_finger_t    fingers[AZOTEQ_IQS5XX_MAX_FINGERS];
+} azoteq_iqs5xx_touch_data_t;
+
+STATIC_ASSERT(sizeof(azoteq_iqs5xx_touch_data_t) == 45, "azoteq_iqs5xx_touch_data_t should be 45 bytes");
+
 typedef struct PACKED {
     bool sw_input : 1;
     bool sw_input_select : 1;
@@ -191,6 +214,9 @@ i2c_status_t   azoteq_iqs5xx_set_gesture_config(bool end_session);
 i2c_status_t   azoteq_iqs5xx_set_xy_config(bool flip_x, bool flip_y, bool switch_xy, bool palm_reject, bool end_session);
 i2c_status_t   azoteq_iqs5xx_reset_suspend(bool reset, bool suspend, bool end_session);
 i2c_status_t   azoteq_iqs5xx_get_base_data(azoteq_iqs5xx_base_data_t *base_data);
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+i2c_status_t azoteq_iqs5xx_get_touch_data(azoteq_iqs5xx_touch_data_t *touch_data);
+#endif
 void           azoteq_iqs5xx_set_cpi(uint16_t cpi);
 uint16_t       azoteq_iqs5xx_get_cpi(void);
 uint16_t       azoteq_iqs5xx_get_product(void);
@@ -366,7 +366,7 @@ void cirque_pinnacle_enable_cursor_glide(bool enable) {
     cursor_glide_enable = enable;
 }
 
-void cirque_pinnacle_configure_cursor_glide(float trigger_px) {
+void cirque_pinnacle_configure_cursor_glide(uint16_t trigger_px) {
     glide.config.trigger_px = trigger_px;
 }
 #endif
@@ -385,7 +385,9 @@ report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
     uint16_t          scale     = cirque_pinnacle_get_scale();
     pinnacle_data_t   touchData = cirque_pinnacle_read_data();
     mouse_xy_report_t report_x = 0, report_y = 0;
-    static uint16_t   x = 0, y = 0, last_scale = 0;
+#    ifndef POINTING_DEVICE_TOUCH_ENABLE
+    static uint16_t x = 0, y = 0, last_scale = 0;
+#    endif
 
 #    if defined(CIRQUE_PINNACLE_TAP_ENABLE)
     mouse_report.buttons = pointing_device_handle_buttons(mouse_report.buttons, false, POINTING_DEVICE_BUTTON1);
@@ -409,6 +411,10 @@ report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
         return mouse_report;
     }
 
+#    ifdef POINTING_DEVICE_KINETIC_ENABLE
+    pointing_device_kinetic_set_contact(touchData.touchDown);
+#    endif
+
     if (touchData.touchDown) {
         pd_dprintf("cirque_pinnacle touchData x=%4d y=%4d z=%2d\n", touchData.xValue, touchData.yValue, touchData.zValue);
     }
@@ -421,6 +427,19 @@ report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
     cirque_pinnacle_scale_data(&touchData, scale, scale);
 
     if (!cirque_pinnacle_gestures(&mouse_report, touchData)) {
+#    ifdef POINTING_DEVICE_TOUCH_ENABLE
+        // A single contact, gestures come from how long and how far it moves
+        pointing_device_touch_frame_t frame = {
+            .time     = timer_read(),
+            .width    = scale,
+            .height   = scale,
+            .count    = touchData.touchDown,
+            .contacts = {{.x = touchData.xValue, .y = touchData.yValue, .pressure = MIN(touchData.zValue, UINT8_MAX)}},
+        };
+        mouse_report = pointing_device_touch_process(&frame, mouse_report);
+        report_x     = mouse_report.x;
+        report_y     = mouse_report.y;
+#    else
         if (last_scale && scale == last_scale && x && y && touchData.xValue && touchData.yValue) {
             report_x = CONSTRAIN_HID_XY((int16_t)(touchData.xValue - x));
             report_y = CONSTRAIN_HID_XY((int16_t)(touchData.yValue - y));
@@ -428,6 +447,7 @@ report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
         x          = touchData.xValue;
         y          = touchData.yValue;
         last_scale = scale;
+#    endif
 
 #    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
         if (cursor_glide_enable) {
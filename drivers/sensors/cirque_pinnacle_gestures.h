@@ -24,6 +24,15 @@ typedef struct {
     bool circular_scroll_enable;
 } cirque_pinnacle_features_t;
 
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+#    if !CIRQUE_PINNACLE_POSITION_MODE
+#        error "POINTING_DEVICE_TOUCH_ENABLE is not supported in relative mode"
+#    endif
+#    ifdef CIRQUE_PINNACLE_TAP_ENABLE
+#        error "CIRQUE_PINNACLE_TAP_ENABLE and POINTING_DEVICE_TOUCH_ENABLE both recognise taps, enable only one"
+#    endif
+#endif
+
 #if defined(CIRQUE_PINNACLE_TAP_ENABLE) && CIRQUE_PINNACLE_POSITION_MODE
 #    ifndef CIRQUE_PINNACLE_TAPPING_TERM
 #        include "action.h"
@@ -103,7 +112,7 @@ void cirque_pinnacle_enable_cursor_glide(bool enable);
  * Configure inertial cursor.
  * @param trigger_px Movement required to trigger cursor glide, set this to non-zero if you have some amount of hover.
  */
-void cirque_pinnacle_configure_cursor_glide(float trigger_px);
+void cirque_pinnacle_configure_cursor_glide(uint16_t trigger_px);
 #endif
 
 /* Process available gestures */
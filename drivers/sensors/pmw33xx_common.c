@@ -23,6 +23,21 @@ static const pin_t cs_pins_right[] = PMW33XX_CS_PINS_RIGHT;
 static bool in_burst_left[ARRAY_SIZE(cs_pins_left)]   = {0};
 static bool in_burst_right[ARRAY_SIZE(cs_pins_right)] = {0};
 
+#ifdef PMW33XX_ASYNC_BURST
+#    ifdef POINTING_DEVICE_MOTION_PIN
+// Reads stop once the motion pin is released, leaving the final burst of a movement behind until the next one
+#        error PMW33XX_ASYNC_BURST is not supported with POINTING_DEVICE_MOTION_PIN
+#    endif
+
+// Sensor whose burst is still being received, and the bursts collected but not returned yet
+static int8_t           burst_sensor = -1;
+static pmw33xx_report_t burst_buffer;
+static pmw33xx_report_t burst_left[ARRAY_SIZE(cs_pins_left)]   = {0};
+static pmw33xx_report_t burst_right[ARRAY_SIZE(cs_pins_right)] = {0};
+
+#    define burst_reports (is_keyboard_left() ? burst_left : burst_right)
+#endif
+
 bool __attribute__((cold)) pmw33xx_upload_firmware(uint8_t sensor);
 bool __attribute__((cold)) pmw33xx_check_signature(uint8_t sensor);
 
@@ -47,7 +62,39 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi) {
     }
 }
 
+static void pmw33xx_burst_finish(uint8_t sensor, pmw33xx_report_t *report) {
+    // panic recovery, sometimes burst mode works weird.
+    if (report->motion.w & 0b111) {
+        in_burst[sensor] = false;
+    }
+
+    pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report->motion.w, report->delta_x, report->delta_y);
+
+    report->delta_x *= -1;
+    report->delta_y *= -1;
+}
+
+#ifdef PMW33XX_ASYNC_BURST
+static void pmw33xx_burst_collect(void) {
+    if (burst_sensor < 0) {
+        return;
+    }
+
+    uint8_t sensor = burst_sensor;
+    burst_sensor   = -1;
+
+    // Waits for the transfer, which normally completed while the rest of the scan ran
+    spi_stop();
+    burst_reports[sensor] = burst_buffer;
+    pmw33xx_burst_finish(sensor, &burst_reports[sensor]);
+}
+#endif
+
 bool pmw33xx_spi_start(uint8_t sensor) {
+#ifdef PMW33XX_ASYNC_BURST
+    // Free up the bus first
+    pmw33xx_burst_collect();
+#endif
     if (!spi_start(cs_pins[sensor], false, 3, PMW33XX_SPI_DIVISOR)) {
         spi_stop();
         return false;
@@ -219,19 +266,22 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
     spi_write(REG_Motion_Burst);
     wait_us(35); // waits for tSRAD_MOTBR
 
-    spi_receive((uint8_t *)&report, sizeof(report));
-
-    // panic recovery, sometimes burst mode works weird.
-    if (report.motion.w & 0b111) {
-        in_burst[sensor] = false;
+#ifdef PMW33XX_ASYNC_BURST
+    // Left on the bus for the next read, from this or any other sensor, to collect
+    if (spi_receive_async((uint8_t *)&burst_buffer, sizeof(burst_buffer)) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        return report;
     }
+    burst_sensor = sensor;
 
+    report                = burst_reports[sensor];
+    burst_reports[sensor] = (pmw33xx_report_t){0};
+#else
+    spi_receive((uint8_t *)&report, sizeof(report));
     spi_stop();
 
-    pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, report.delta_x, report.delta_y);
-
-    report.delta_x *= -1;
-    report.delta_y *= -1;
+    pmw33xx_burst_finish(sensor, &report);
+#endif
 
     return report;
 }
@@ -148,6 +148,9 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi);
  * @brief Reads and clears the current delta, and motion register values on the
  * given sensor.
  *
+ * With PMW33XX_ASYNC_BURST the registers are received in the background
+ * instead, and returned by the next call for the same sensor.
+ *
  * @param sensor Index of the sensors chip select pin
  * @return pmw33xx_report_t Current values of the sensor, if errors occurred all
  * fields are set to zero
@@ -103,9 +103,30 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
  */
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start receiving multiple bytes from the selected SPI device, without waiting for them to arrive.
+ *
+ * The contents of `data` are undefined until `spi_is_busy()` returns `false`. Platforms which cannot receive in the background do so before returning.
+ *
+ * \param data A pointer to a buffer to read into, which must remain valid until the transfer has completed.
+ * \param length The number of bytes to read. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_TIMEOUT` if the timeout period elapses while receiving before returning, `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_receive_async(uint8_t *data, uint16_t length);
+
+/**
+ * \brief Check whether a transfer started by `spi_receive_async()` is still in progress.
+ *
+ * \return `true` if the transfer has not completed yet, otherwise `false`.
+ */
+bool spi_is_busy(void);
+
 /**
  * \brief End the current SPI transaction. This will deassert the slave select pin and reset the endianness, mode and divisor configured by `spi_start()`.
  *
+ * Waits for any transfer started by `spi_receive_async()` to complete first, aborting it if the timeout period elapses.
+ *
  */
 void spi_stop(void);
 
@@ -0,0 +1,8 @@
+#include <stdio.h>
+#include <stdarg.h>
+void putchar_(char c);
+int vsnprintf_(char *s, size_t n, const char *f, va_list a) { return vsnprintf(s, n, f, a); }
+int vprintf_(const char *f, va_list a) { char b[1024]; int r = vsnprintf(b, sizeof b, f, a); for (char *p = b; *p; ++p) putchar_(*p); return r; }
+int printf_(const char *f, ...) { va_list a; va_start(a, f); int r = vprintf_(f, a); va_end(a); return r; }
+int sprintf_(char *s, const char *f, ...) { va_list a; va_start(a, f); int r = vsprintf(s, f, a); va_end(a); return r; }
+int snprintf_(char *s, size_t n, const char *f, ...) { va_list a; va_start(a, f); int r = vsnprintf(s, n, f, a); va_end(a); return r; }
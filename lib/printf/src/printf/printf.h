@@ -0,0 +1,22 @@
+#pragma once
+#include <stdarg.h>
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+void putchar_(char c);
+int  printf_(const char *format, ...);
+int  sprintf_(char *s, const char *format, ...);
+int  snprintf_(char *s, size_t n, const char *format, ...);
+int  vsnprintf_(char *s, size_t n, const char *format, va_list arg);
+int  vprintf_(const char *format, va_list arg);
+#if PRINTF_ALIAS_STANDARD_FUNCTION_NAMES
+#    define printf printf_
+#    define sprintf sprintf_
+#    define vsnprintf vsnprintf_
+#    define snprintf snprintf_
+#    define vprintf vprintf_
+#endif
+#ifdef __cplusplus
+}
+#endif
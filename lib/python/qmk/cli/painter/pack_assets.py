@@ -0,0 +1,81 @@
+"""Packs converted Quantum Painter assets into a blob suitable for external flash.
+"""
+import datetime
+import re
+from io import BytesIO
+from string import Template
+
+from qmk.path import normpath
+from qmk.painter import command_args_str
+from qmk.painter_qpa import pack_assets
+from milc import cli
+
+header_file_template = """\
+// Copyright ${year} QMK -- generated source code only, assets retain original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `${generator_command}` with arguments:
+${command_args}
+
+#pragma once
+
+#include <qp.h>
+
+// Load with qp_load_image_flash(qp_flash_asset_address(...)) or qp_load_font_flash(qp_flash_asset_address(...))
+enum ${sane_name}_assets {
+${asset_lines}
+};
+
+#define ${upper_name}_SIZE ${byte_count}
+"""
+
+
+@cli.argument('-i', '--input', arg_only=True, nargs='+', required=True, help='Specify input QGF/QFF files, generated with the `--raw` option.')
+@cli.argument('-o', '--output', required=True, help='Specify output blob file, a header is generated alongside it.')
+@cli.argument('-a', '--alignment', default=4, type=int, help='Alignment of each asset within the blob. Defaults to 4.')
+@cli.subcommand('Packs converted images and fonts into a blob for external flash')
+def painter_pack_assets(cli):
+    """Packs raw QGF/QFF files into a Quantum Painter asset table for external flash.
+
+    Each input gets an index in the generated header, usable with `qp_flash_asset_address()` on the firmware side.
+    """
+    inputs = [normpath(i) for i in cli.args.input]
+    for i in inputs:
+        if not i.exists():
+            cli.log.error(f'Input file {i} does not exist!')
+            return False
+
+    if cli.args.alignment <= 0:
+        cli.log.error('Alignment must be a positive number!')
+        return False
+
+    # Pack the assets
+    assets = [i.read_bytes() for i in inputs]
+    out_data = BytesIO()
+    offsets = pack_assets(assets, out_data, alignment=cli.args.alignment)
+    out_bytes = out_data.getvalue()
+
+    output = normpath(cli.args.output)
+    print(f"Writing {output}...")
+    output.write_bytes(out_bytes)
+
+    # Render the header listing the asset indices
+    sane_name = re.sub(r"[^a-zA-Z0-9]", "_", output.stem)
+    asset_lines = []
+    for idx, (i, offset) in enumerate(zip(inputs, offsets)):
+        asset_name = re.sub(r"[^a-zA-Z0-9]", "_", i.name).upper()
+        asset_lines.append(f"    QPA_{asset_name} = {idx}, // offset {offset}, {len(assets[idx])} bytes")
+
+    subs = {
+        "year": datetime.date.today().strftime("%Y"),
+        "generator_command": "painter-pack-assets",
+        "command_args": command_args_str(cli, "painter_pack_assets"),
+        "sane_name": sane_name,
+        "upper_name": sane_name.upper(),
+        "asset_lines": "\n".join(asset_lines),
+        "byte_count": len(out_bytes),
+    }
+
+    header_file = output.parent / f"{output.name}.h"
+    print(f"Writing {header_file}...")
+    header_file.write_text(Template(header_file_template).substitute(subs))
@@ -125,7 +125,7 @@ def _render_image_metadata(metadata):
             # Unpack rect's coords
             l, t, r, b = v["delta_rect"]
 
-            delta_px = (r - l) * (b - t)
+            delta_px = (r - l + 1) * (b - t + 1)
             px = size["width"] * size["height"]
 
             # FIXME: May need need more chars here too
@@ -260,7 +260,7 @@ def _for_all_frames(x: FunctionType, /, images):
             frame_num += 1
 
 
-def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
+def _compress_image(frame, last_frame, *, use_rle, use_deltas, prefer_deltas, format_, **_kwargs):
     # Convert the original frame so we can do comparisons
     converted = qmk.painter.convert_requested_format(frame, format_)
     graphic_data = qmk.painter.convert_image_bytes(converted, format_)
@@ -282,33 +282,40 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
         # Get the bounding box of those differences
         bbox = diff.getbbox()
 
-        # If we have a valid bounding box...
-        if bbox:
-            # ...create the delta frame by cropping the original.
-            delta_frame = frame.crop(bbox)
-
-            # Convert the delta frame to the requested format
-            delta_converted = qmk.painter.convert_requested_format(delta_frame, format_)
-            delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format_)
-
-            # Work out how large the delta frame is going to be with compression etc.
-            delta_raw_data = delta_graphic_data[1]
-            if use_rle:
-                delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-            delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-            delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
-
-            # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
-            # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
-            # sizing constraints.
-            if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data):
-                # Copy across all the delta equivalents so that the rest of the processing acts on those
-                graphic_data = delta_graphic_data
-                raw_data = delta_raw_data
-                rle_data = delta_rle_data
-                use_raw_this_frame = delta_use_raw_this_frame
-                image_data = delta_image_data
-                use_delta_this_frame = True
+        # Identical frames still need a frame entry for timing purposes, so emit the smallest possible delta (the
+        # top-left pixel, which is unchanged) instead of redrawing the whole image
+        if not bbox:
+            bbox = (0, 0, 1, 1)
+
+        # Create the delta frame by cropping the original.
+        delta_frame = frame.crop(bbox)
+
+        # Convert the delta frame to the requested format
+        delta_converted = qmk.painter.convert_requested_format(delta_frame, format_)
+        delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format_)
+
+        # Work out how large the delta frame is going to be with compression etc.
+        delta_raw_data = delta_graphic_data[1]
+        if use_rle:
+            delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
+        delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
+        delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
+
+        # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
+        # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
+        # sizing constraints.
+        # If deltas are preferred, use them whenever they cover fewer pixels than the whole frame instead, as the
+        # number of pixels pushed to the display dominates rendering time for animations.
+        delta_is_smaller = (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data)
+        delta_has_fewer_pixels = (delta_frame.width * delta_frame.height) < (frame.width * frame.height)
+        if delta_is_smaller or (prefer_deltas and delta_has_fewer_pixels):
+            # Copy across all the delta equivalents so that the rest of the processing acts on those
+            graphic_data = delta_graphic_data
+            raw_data = delta_raw_data
+            rle_data = delta_rle_data
+            use_raw_this_frame = delta_use_raw_this_frame
+            image_data = delta_image_data
+            use_delta_this_frame = True
 
         # Default to whole image
         bbox = bbox or [0, 0, *frame.size]
@@ -437,7 +444,7 @@ def _save(im, fp, _filename):
     frame_offsets.write(fp)
 
     # Iterate over each if the input frames, writing it to the output in the process
-    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
+    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), prefer_deltas=encoderinfo.get("prefer_deltas", False), use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
     for_all_frames(write_frame)
 
     # Go back and update the graphics descriptor now that we can determine the final file size
@@ -0,0 +1,84 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Quantum Painter Asset "QPA" table format, used to pack QGF/QFF assets into a blob for external flash.
+
+from PIL._binary import o8, o16le as o16, o32le as o32
+from qmk.painter_qgf import o24, QGFBlockHeader
+
+########################################################################################################################
+
+
+class QPATableDescriptorV1:
+    type_id = 0x10
+    length = 14
+    magic = 0x415051
+
+    def __init__(self):
+        self.header = QGFBlockHeader()
+        self.header.type_id = QPATableDescriptorV1.type_id
+        self.header.length = QPATableDescriptorV1.length
+        self.version = 1
+        self.total_file_size = 0
+        self.asset_count = 0
+
+    def write(self, fp):
+        self.header.write(fp)
+        fp.write(
+            b''  # start off with empty bytes...
+            + o24(QPATableDescriptorV1.magic)  # magic
+            + o8(self.version)  # version
+            + o32(self.total_file_size)  # file size
+            + o32((~self.total_file_size) & 0xFFFFFFFF)  # negated file size
+            + o16(self.asset_count)  # asset count
+        )
+
+
+########################################################################################################################
+
+
+class QPAAssetOffsetDescriptorV1:
+    type_id = 0x11
+
+    def __init__(self, asset_count):
+        self.header = QGFBlockHeader()
+        self.header.type_id = QPAAssetOffsetDescriptorV1.type_id
+        self.asset_offsets = [0] * asset_count
+
+    def write(self, fp):
+        self.header.length = len(self.asset_offsets) * 4
+        self.header.write(fp)
+        for offset in self.asset_offsets:
+            fp.write(o32(offset))
+
+
+########################################################################################################################
+
+
+def pack_assets(assets, fp, *, alignment=4):
+    """Packs a list of raw QGF/QFF asset blobs into a QPA blob, writing it to `fp`.
+
+    Each asset is aligned to `alignment` bytes relative to the start of the table. Returns the offset of each asset.
+    """
+    table_descriptor = QPATableDescriptorV1()
+    table_descriptor.asset_count = len(assets)
+    asset_offsets = QPAAssetOffsetDescriptorV1(len(assets))
+
+    # Write out dummy descriptors, we'll come back and fill them in once we know where everything ended up
+    table_descriptor.write(fp)
+    asset_offsets.write(fp)
+
+    for idx, asset in enumerate(assets):
+        padding = (alignment - (fp.tell() % alignment)) % alignment
+        fp.write(b'\xFF' * padding)  # matches erased flash
+        asset_offsets.asset_offsets[idx] = fp.tell()
+        fp.write(bytes(asset))
+
+    # Go back and update the descriptors now that the final layout is known
+    table_descriptor.total_file_size = fp.tell()
+    fp.seek(0, 0)
+    table_descriptor.write(fp)
+    asset_offsets.write(fp)
+    fp.seek(0, 2)
+
+    return asset_offsets.asset_offsets
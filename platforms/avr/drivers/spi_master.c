@@ -187,6 +187,15 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_receive_async(uint8_t *data, uint16_t length) {
+    // No DMA, receive before returning
+    return spi_receive(data, length);
+}
+
+bool spi_is_busy(void) {
+    return false;
+}
+
 void spi_stop(void) {
     if (current_slave_pin != NO_PIN) {
         gpio_set_pin_output(current_slave_pin);
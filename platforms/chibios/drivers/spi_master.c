@@ -23,6 +23,10 @@
 #    define SPI_DRIVER SPID2
 #endif
 
+#ifndef SPI_TIMEOUT
+#    define SPI_TIMEOUT 100
+#endif
+
 #ifndef SPI_SCK_PIN
 #    define SPI_SCK_PIN B13
 #endif
@@ -460,8 +464,29 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_receive_async(uint8_t *data, uint16_t length) {
+    if (!spiStarted || spi_is_busy()) {
+        return SPI_STATUS_ERROR;
+    }
+    spiStartReceive(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_is_busy(void) {
+    // Without an end callback configured, the driver goes back to SPI_READY as soon as the transfer completes
+    return SPI_DRIVER.state == SPI_ACTIVE;
+}
+
 void spi_stop(void) {
     if (spiStarted) {
+        systime_t start = chVTGetSystemTimeX();
+        while (spi_is_busy()) {
+            if (chVTTimeElapsedSinceX(start) >= TIME_MS2I(SPI_TIMEOUT)) {
+                // Give up on the transfer rather than stalling the scan
+                spiAbort(&SPI_DRIVER);
+                break;
+            }
+        }
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
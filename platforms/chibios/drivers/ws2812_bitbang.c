@@ -1,6 +1,8 @@
+#include <string.h>
 #include "ws2812.h"
 
 #include "gpio.h"
+#include "timer.h"
 #include "chibios_config.h"
 
 // DEPRECATED - DO NOT USE
@@ -78,6 +80,11 @@ void sendByte(uint8_t byte) {
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+// Colours last sent to the strip, used to skip sending identical frames
+static ws2812_led_t ws2812_leds_sent[WS2812_LED_COUNT];
+static bool         ws2812_sent      = false;
+static uint32_t     ws2812_sent_time = 0;
+
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 }
@@ -98,6 +105,15 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+    // LEDs latch their colour, so there is no need to spend time with interrupts disabled resending it -- other than
+    // an occasional refresh, in case a frame was missed
+    if (ws2812_sent && timer_elapsed32(ws2812_sent_time) < WS2812_REFRESH_MS && memcmp(ws2812_leds, ws2812_leds_sent, sizeof(ws2812_leds)) == 0) {
+        return;
+    }
+    memcpy(ws2812_leds_sent, ws2812_leds, sizeof(ws2812_leds));
+    ws2812_sent      = true;
+    ws2812_sent_time = timer_read32();
+
     // this code is very time dependent, so we need to disable interrupts
     chSysLock();
 
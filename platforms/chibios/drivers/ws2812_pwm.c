@@ -1,3 +1,4 @@
+#include <string.h>
 #include "ws2812.h"
 #include "gpio.h"
 #include "chibios_config.h"
@@ -394,6 +395,9 @@ void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b,
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+// Colours currently encoded into the frame buffer; it starts out all zero duty cycle, i.e. off
+static ws2812_led_t ws2812_leds_encoded[WS2812_LED_COUNT];
+
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     ws2812_leds[index].r = red;
     ws2812_leds[index].g = green;
@@ -410,7 +414,12 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+    // The DMA streams the frame buffer continuously, so only LEDs which have changed need re-encoding
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        if (memcmp(&ws2812_leds[i], &ws2812_leds_encoded[i], sizeof(ws2812_led_t)) == 0) {
+            continue;
+        }
+        ws2812_leds_encoded[i] = ws2812_leds[i];
 #if defined(WS2812_RGBW)
         ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
 #else
@@ -1,5 +1,7 @@
+#include <string.h>
 #include "ws2812.h"
 #include "gpio.h"
+#include "timer.h"
 #include "util.h"
 #include "chibios_config.h"
 
@@ -96,6 +98,16 @@
 #    define WS2812_SPI_BUFFER_MODE 0 // normal buffer
 #endif
 
+// Use a second transmit buffer, swapped in from the transfer complete callback
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+#    if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#        error "WS2812_SPI_DOUBLE_BUFFER cannot be combined with WS2812_SPI_USE_CIRCULAR_BUFFER or WS2812_SPI_SYNC"
+#    endif
+#    define WS2812_SPI_BUFFER_COUNT 2
+#else
+#    define WS2812_SPI_BUFFER_COUNT 1
+#endif
+
 #if defined(USE_GPIOV1)
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE_PUSHPULL
 #else
@@ -113,7 +125,20 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+static uint8_t txbuf[WS2812_SPI_BUFFER_COUNT][PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+
+// Colours currently encoded into each transmit buffer, so only changed LEDs are re-encoded
+static ws2812_led_t txbuf_leds[WS2812_SPI_BUFFER_COUNT][WS2812_LED_COUNT];
+static bool         txbuf_encoded[WS2812_SPI_BUFFER_COUNT];
+// Buffer most recently handed to the SPI driver, -1 until the first flush, and when it was handed over
+static int8_t   txbuf_last      = -1;
+static uint32_t txbuf_last_time = 0;
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+// Buffer currently being transmitted (-1 when idle), and whether the other one is queued behind it
+static volatile int8_t txbuf_active  = -1;
+static volatile bool   txbuf_pending = false;
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -133,8 +158,8 @@ static uint8_t get_protocol_eq(uint8_t data, int pos) {
     return eq;
 }
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* buf, ws2812_led_t color, int pos) {
+    uint8_t* tx_start = &buf[PREAMBLE_SIZE];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
     for (int j = 0; j < 4; j++)
@@ -166,6 +191,37 @@ static void set_led_color_rgb(ws2812_led_t color, int pos) {
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+/*
+ * Bring the given transmit buffer up to date with ws2812_leds, only encoding
+ * the LEDs whose colour differs from what the buffer already holds.
+ */
+static void encode_buffer(uint8_t index) {
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        if (!txbuf_encoded[index] || memcmp(&ws2812_leds[i], &txbuf_leds[index][i], sizeof(ws2812_led_t)) != 0) {
+            set_led_color_rgb(txbuf[index], ws2812_leds[i], i);
+            txbuf_leds[index][i] = ws2812_leds[i];
+        }
+    }
+    txbuf_encoded[index] = true;
+}
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+static void ws2812_spi_complete_cb(SPIDriver* spip) {
+    chSysLockFromISR();
+    if (txbuf_pending) {
+        txbuf_pending = false;
+        txbuf_active  = 1 - txbuf_active;
+        spiStartSendI(spip, sizeof(txbuf[0]), txbuf[txbuf_active]);
+    } else {
+        txbuf_active = -1;
+    }
+    chSysUnlockFromISR();
+}
+#    define WS2812_SPI_COMPLETE_CB ws2812_spi_complete_cb
+#else
+#    define WS2812_SPI_COMPLETE_CB NULL
+#endif
+
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
@@ -180,7 +236,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_COMPLETE_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -198,7 +254,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_COMPLETE_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -219,7 +275,7 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, sizeof(txbuf[0]), txbuf[0]);
 #endif
 }
 
@@ -239,17 +295,43 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+    // Take back a queued buffer which has not started yet, and pick whichever buffer is not on the wire
+    chSysLock();
+    bool reclaimed = txbuf_pending;
+    txbuf_pending  = false;
+    uint8_t index  = txbuf_active < 0 ? (txbuf_last < 0 ? 0 : txbuf_last) : 1 - txbuf_active;
+    chSysUnlock();
+#else
+    const bool    reclaimed = false;
+    const uint8_t index     = 0;
+#endif
+
+    // Nothing to do if the LEDs already show (or are about to show) these colours, unless they are due a refresh
+    if (!reclaimed && txbuf_last >= 0 && timer_elapsed32(txbuf_last_time) < WS2812_REFRESH_MS && memcmp(ws2812_leds, txbuf_leds[txbuf_last], sizeof(ws2812_leds)) == 0) {
+        return;
     }
 
+    encode_buffer(index);
+    txbuf_last      = index;
+    txbuf_last_time = timer_read32();
+
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
+    // Instead spiSend can be used to send synchronously, or WS2812_SPI_DOUBLE_BUFFER used to queue the next frame.
 #ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+#    if defined(WS2812_SPI_SYNC)
+    spiSend(&WS2812_SPI_DRIVER, sizeof(txbuf[0]), txbuf[index]);
+#    elif defined(WS2812_SPI_DOUBLE_BUFFER)
+    chSysLock();
+    if (txbuf_active < 0) {
+        txbuf_active = index;
+        spiStartSendI(&WS2812_SPI_DRIVER, sizeof(txbuf[0]), txbuf[index]);
+    } else {
+        txbuf_pending = true;
+    }
+    chSysUnlock();
 #    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, sizeof(txbuf[0]), txbuf[index]);
 #    endif
 #endif
 }
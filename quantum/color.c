@@ -19,46 +19,42 @@
 #include "progmem.h"
 #include "util.h"
 
-rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
-    rgb_t    rgb;
-    uint8_t  region, remainder, p, q, t;
-    uint16_t h, s, v;
-
-    if (hsv.s == 0) {
-#ifdef USE_CIE1931_CURVE
-        if (use_cie) {
-            rgb.r = rgb.g = rgb.b = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-        } else {
-            rgb.r = hsv.v;
-            rgb.g = hsv.v;
-            rgb.b = hsv.v;
-        }
-#else
-        rgb.r = hsv.v;
-        rgb.g = hsv.v;
-        rgb.b = hsv.v;
-#endif
-        return rgb;
-    }
-
-    h = hsv.h;
-    s = hsv.s;
+static inline uint8_t hsv_to_value(uint8_t v, bool use_cie) {
 #ifdef USE_CIE1931_CURVE
     if (use_cie) {
-        v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-    } else {
-        v = hsv.v;
+        return pgm_read_byte(&CIE1931_CURVE[v]);
     }
 #else
-    v = hsv.v;
+    (void)use_cie;
 #endif
+    return v;
+}
+
+static inline rgb_t hsv_to_rgb_kernel(uint8_t h, uint8_t s, uint8_t v) {
+    rgb_t   rgb;
+    uint8_t region, remainder, p, q, t;
+
+    if (s == 0) {
+        rgb.r = v;
+        rgb.g = v;
+        rgb.b = v;
+        return rgb;
+    }
 
     region    = h * 6 / 255;
     remainder = (h * 2 - region * 85) * 3;
 
     p = (v * (255 - s)) >> 8;
+#ifndef __AVR__
+    // Every product below fits in 16 bits, so q and t can share each multiply as two 16-bit lanes
+    uint32_t sr = s * (remainder | ((uint32_t)(255 - remainder) << 16));
+    uint32_t qt = v * (0x00FF00FF - ((sr >> 8) & 0x00FF00FF));
+    q           = qt >> 8;
+    t           = qt >> 24;
+#else
     q = (v * (255 - ((s * remainder) >> 8))) >> 8;
     t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+#endif
 
     switch (region) {
         case 6:
@@ -97,6 +93,21 @@ rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
     return rgb;
 }
 
+rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
+    return hsv_to_rgb_kernel(hsv.h, hsv.s, hsv_to_value(hsv.v, use_cie));
+}
+
+static void hsv_to_rgb_batch_impl(const hsv_t *hsv, rgb_t *rgb, uint8_t count, bool use_cie) {
+    for (uint8_t i = 0; i < count; i++) {
+        // Runs of identical colours are common (solid effects, unlit keys), so reuse the previous result
+        if (i > 0 && hsv[i].h == hsv[i - 1].h && hsv[i].s == hsv[i - 1].s && hsv[i].v == hsv[i - 1].v) {
+            rgb[i] = rgb[i - 1];
+        } else {
+            rgb[i] = hsv_to_rgb_kernel(hsv[i].h, hsv[i].s, hsv_to_value(hsv[i].v, use_cie));
+        }
+    }
+}
+
 rgb_t hsv_to_rgb(hsv_t hsv) {
 #ifdef USE_CIE1931_CURVE
     return hsv_to_rgb_impl(hsv, true);
@@ -108,3 +119,36 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_batch_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+#endif
+}
+
+uint32_t rgb_power_estimate(const rgb_t *leds, uint8_t count, const rgb_power_model_t *model) {
+    uint32_t r = 0, g = 0, b = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        r += leds[i].r;
+        g += leds[i].g;
+        b += leds[i].b;
+    }
+
+    return (uint32_t)model->idle * count + (r * model->r + g * model->g + b * model->b) / 255;
+}
+
+uint16_t rgb_power_scale(uint32_t estimate, uint16_t budget, uint8_t count, const rgb_power_model_t *model) {
+    if (estimate <= budget) {
+        return RGB_POWER_SCALE_MAX;
+    }
+
+    // Only the channel current scales, the idle draw is always there
+    uint32_t idle = (uint32_t)model->idle * count;
+    if (budget <= idle) {
+        return 0;
+    }
+    return ((budget - idle) << 8) / (estimate - idle);
+}
@@ -95,3 +95,27 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+void  hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count);
+
+// Current drawn by a single LED, in mA
+typedef struct {
+    uint8_t r;    // red channel at full brightness
+    uint8_t g;    // green channel at full brightness
+    uint8_t b;    // blue channel at full brightness
+    uint8_t idle; // driver circuitry, even when dark
+} rgb_power_model_t;
+
+// The unit of rgb_power_scale(), ie. a scale that leaves the frame untouched
+#define RGB_POWER_SCALE_MAX 256
+
+uint32_t rgb_power_estimate(const rgb_t *leds, uint8_t count, const rgb_power_model_t *model);
+uint16_t rgb_power_scale(uint32_t estimate, uint16_t budget, uint8_t count, const rgb_power_model_t *model);
+
+static inline rgb_t rgb_power_apply(rgb_t rgb, uint16_t scale) {
+    if (scale < RGB_POWER_SCALE_MAX) {
+        rgb.r = (rgb.r * scale) >> 8;
+        rgb.g = (rgb.g * scale) >> 8;
+        rgb.b = (rgb.b * scale) >> 8;
+    }
+    return rgb;
+}
@@ -16,6 +16,102 @@
 
 #include "digitizer.h"
 
+#ifdef DIGITIZER_TOUCHPAD
+
+#    include "compiler_support.h"
+#    include "timer.h"
+#    include "util.h"
+
+// The report descriptor describes each contact in five bytes
+STATIC_ASSERT(sizeof(report_digitizer_contact_t) == 5, "Digitizer touchpad contact out of spec.");
+
+static struct {
+    digitizer_contact_t contacts[DIGITIZER_TOUCHPAD_CONTACTS]; // on the touchpad now
+    digitizer_contact_t sent[DIGITIZER_TOUCHPAD_CONTACTS];     // down in the last report sent
+    uint8_t             count;
+    uint8_t             sent_count;
+    uint16_t            time; // when the contacts were set
+    uint16_t            last_send;
+    bool                dirty;
+} touchpad;
+
+static const digitizer_contact_t *touchpad_find(const digitizer_contact_t *contacts, uint8_t count, uint8_t id) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (contacts[i].id == id) {
+            return &contacts[i];
+        }
+    }
+    return NULL;
+}
+
+static report_digitizer_contact_t touchpad_report_contact(const digitizer_contact_t *contact, bool tip) {
+    return (report_digitizer_contact_t){
+        .tip        = tip,
+        .confidence = true,
+        .id         = contact->id & 0x3F,
+        .x          = MIN(contact->x, 0x7FFF),
+        .y          = MIN(contact->y, 0x7FFF),
+    };
+}
+
+void digitizer_touchpad_set_contacts(const digitizer_contact_t *contacts, uint8_t count) {
+    count = MIN(count, DIGITIZER_TOUCHPAD_CONTACTS);
+
+    // Sensors are read more often than fingers move, only changes are worth a report
+    bool changed = count != touchpad.count;
+    for (uint8_t i = 0; i < count && !changed; i++) {
+        changed = contacts[i].id != touchpad.contacts[i].id || contacts[i].x != touchpad.contacts[i].x || contacts[i].y != touchpad.contacts[i].y;
+    }
+    if (!changed) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        touchpad.contacts[i] = contacts[i];
+    }
+    touchpad.count = count;
+    touchpad.time  = timer_read();
+    touchpad.dirty = true;
+}
+
+void digitizer_touchpad_task(void) {
+    if (!touchpad.dirty || TIMER_DIFF_16(timer_read(), touchpad.last_send) < DIGITIZER_TOUCHPAD_INTERVAL_MS) {
+        return;
+    }
+
+    report_digitizer_t  report = {.scan_time = touchpad.time * 10}; // in units of 100us, wrapping like the timer
+    digitizer_contact_t down[DIGITIZER_TOUCHPAD_CONTACTS];
+    uint8_t             down_count = 0;
+
+    // Fingers the host knows about are still down or were lifted, which never adds up to more than fit in a report
+    for (uint8_t i = 0; i < touchpad.sent_count; i++) {
+        const digitizer_contact_t *contact = touchpad_find(touchpad.contacts, touchpad.count, touchpad.sent[i].id);
+        if (contact) {
+            down[down_count++] = *contact;
+        }
+        report.contacts[report.contact_count++] = touchpad_report_contact(contact ? contact : &touchpad.sent[i], contact != NULL);
+    }
+
+    // New fingers, those which do not fit next to the lifted ones go in the next report
+    for (uint8_t i = 0; i < touchpad.count && report.contact_count < DIGITIZER_TOUCHPAD_CONTACTS; i++) {
+        if (!touchpad_find(touchpad.sent, touchpad.sent_count, touchpad.contacts[i].id)) {
+            down[down_count++]                      = touchpad.contacts[i];
+            report.contacts[report.contact_count++] = touchpad_report_contact(&touchpad.contacts[i], true);
+        }
+    }
+
+    host_digitizer_touchpad_send(&report);
+
+    for (uint8_t i = 0; i < down_count; i++) {
+        touchpad.sent[i] = down[i];
+    }
+    touchpad.sent_count = down_count;
+    touchpad.dirty      = down_count < touchpad.count;
+    touchpad.last_send  = timer_read();
+}
+
+#else
+
 digitizer_t digitizer_state = {
     .in_range = false,
     .tip      = false,
@@ -74,3 +170,5 @@ void digitizer_set_position(float x, float y) {
     digitizer_state.dirty = true;
     digitizer_flush();
 }
+
+#endif
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include "report.h"
 
 /**
  * \file
@@ -25,6 +28,38 @@
  * \{
  */
 
+#ifdef DIGITIZER_TOUCHPAD
+
+// Shortest time in milliseconds between two touchpad reports, changes in between are sent together
+#    ifndef DIGITIZER_TOUCHPAD_INTERVAL_MS
+#        define DIGITIZER_TOUCHPAD_INTERVAL_MS 8
+#    endif
+
+typedef struct {
+    uint8_t  id; // stays the same while the finger is down
+    uint16_t x;  // from 0 (left) to 0x7FFF (right)
+    uint16_t y;  // from 0 (top) to 0x7FFF (bottom)
+} digitizer_contact_t;
+
+/**
+ * \brief Set the contacts currently on the touchpad.
+ *
+ * The report is sent by `digitizer_touchpad_task()`, contacts which are no longer present are reported as lifted.
+ *
+ * \param contacts The contacts, or `NULL` if `count` is 0.
+ * \param count The number of contacts, further than `DIGITIZER_TOUCHPAD_CONTACTS` are ignored.
+ */
+void digitizer_touchpad_set_contacts(const digitizer_contact_t *contacts, uint8_t count);
+
+/**
+ * \brief Send the touchpad report to the host if the contacts changed, at most once every `DIGITIZER_TOUCHPAD_INTERVAL_MS`.
+ */
+void digitizer_touchpad_task(void);
+
+void host_digitizer_touchpad_send(report_digitizer_t *report);
+
+#else
+
 typedef struct {
     bool  in_range : 1;
     bool  tip : 1;
@@ -81,4 +116,6 @@ void digitizer_set_position(float x, float y);
 
 void host_digitizer_send(digitizer_t *digitizer);
 
+#endif
+
 /** \} */
@@ -140,6 +140,11 @@ void eeconfig_init_quantum(void) {
     eeconfig_update_connection_default();
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    extern void eeconfig_update_pointing_device_accel_default(void);
+    eeconfig_update_pointing_device_accel_default();
+#endif // POINTING_DEVICE_ACCEL_ENABLE
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
     eeconfig_init_kb_datablock();
 #endif // (EECONFIG_KB_DATA_SIZE) > 0
@@ -321,6 +326,15 @@ void eeconfig_update_connection(const connection_config_t *config) {
 }
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+void eeconfig_read_pointing_device_accel(pointing_device_accel_config_t *config) {
+    nvm_eeconfig_read_pointing_device_accel(config);
+}
+void eeconfig_update_pointing_device_accel(const pointing_device_accel_config_t *config) {
+    nvm_eeconfig_update_pointing_device_accel(config);
+}
+#endif // POINTING_DEVICE_ACCEL_ENABLE
+
 bool eeconfig_read_handedness(void) {
     return nvm_eeconfig_read_handedness();
 }
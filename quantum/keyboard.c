@@ -94,6 +94,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef JOYSTICK_ENABLE
 #    include "joystick.h"
 #endif
+#ifdef DIGITIZER_ENABLE
+#    include "digitizer.h"
+#endif
 #ifdef HD44780_ENABLE
 #    include "hd44780.h"
 #endif
@@ -785,6 +788,10 @@ void keyboard_task(void) {
     joystick_task();
 #endif
 
+#if defined(DIGITIZER_ENABLE) && defined(DIGITIZER_TOUCHPAD)
+    digitizer_touchpad_task();
+#endif
+
 #ifdef BATTERY_ENABLE
     battery_task();
 #endif
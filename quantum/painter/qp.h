@@ -88,6 +88,33 @@
 #    define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS FALSE
 #endif
 
+#ifdef QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
+#    ifndef QUANTUM_PAINTER_FLASH_CACHE_BLOCKS
+/**
+ * @def This controls the number of blocks kept in RAM when reading assets from external flash. At least two are
+ *      recommended so that pixel data streaming does not evict the descriptors being read in-between frames.
+ */
+#        define QUANTUM_PAINTER_FLASH_CACHE_BLOCKS 2
+#    endif
+
+#    ifndef QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE
+/**
+ * @def This controls the size of each cached block when reading assets from external flash. Must be a power of two;
+ *      larger blocks mean fewer, longer SPI transactions at the cost of RAM.
+ */
+#        define QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE 256
+#    endif
+
+#    ifndef QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS
+/**
+ * @def This controls the location in external flash of the asset table generated by `qmk painter-pack-assets`.
+ */
+#        define QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS 0
+#    endif
+
+#endif // QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
@@ -353,6 +380,23 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
+/**
+ * Loads an image from external flash.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param address[in] the location of the image data in external flash, such as returned by
+ *                    \ref qp_flash_asset_address
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+
+#endif // QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +484,32 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
+/**
+ * Loads a font from external flash.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the location of the font data in external flash, such as returned by \ref qp_flash_asset_address
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+
+/**
+ * Looks up the location of an asset within the asset table stored in external flash.
+ *
+ * @param asset_index[in] the index of the asset, as listed in the header generated by `qmk painter-pack-assets`
+ * @return the address of the asset in external flash
+ * @return QP_FLASH_ASSET_INVALID if the asset table is invalid or the index is out of range
+ */
+uint32_t qp_flash_asset_address(uint16_t asset_index);
+
+#    define QP_FLASH_ASSET_INVALID 0xFFFFFFFFUL
+
+#endif // QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
@@ -27,6 +27,10 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Draws a span and its mirror image about the supplied center, using the global pixdata buffer with pre-converted native pixels.
+// Horizontal spans cover [a0,a1] and [-a1,-a0] on the rows +/-b, vertical spans the same on the columns +/-b.
+bool qp_internal_mirrored_spans_impl(painter_device_t device, uint16_t centerx, uint16_t centery, int16_t a0, int16_t a1, int16_t b, bool vertical);
+
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
 typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
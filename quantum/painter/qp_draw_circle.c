@@ -7,115 +7,37 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 8-way symmetry to draw circles as spans
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, int16_t run_start, int16_t offsetx, int16_t offsety, bool run_end, bool filled) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    Rather than sending each of those pixels individually, consecutive points
+    sharing the same offsety are gathered into a run [run_start,offsetx]. Once
+    the run ends, it forms four horizontal spans (top and bottom octants) and
+    four vertical spans (left and right octants), each sent as a single
+    viewport+pixdata operation.
 
-    Two special cases exist and have been optimized:
-    1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    For filled circles, each row is drawn exactly once: the rows at
+    +/-offsetx are drawn as the algorithm steps, and the rows at +/-offsety are
+    drawn at their widest once the run on them ends.
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t xpy = ((int16_t)centerx) + ((int16_t)offsety);
-    int16_t xmy = ((int16_t)centerx) - ((int16_t)offsety);
-    int16_t ypx = ((int16_t)centery) + ((int16_t)offsetx);
-    int16_t ymx = ((int16_t)centery) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
-
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
+    if (filled) {
+        if (!qp_internal_mirrored_spans_impl(device, centerx, centery, 0, offsety, offsetx, false)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
+        if (run_end && offsety != offsetx && !qp_internal_mirrored_spans_impl(device, centerx, centery, 0, offsetx, offsety, false)) {
             return false;
         }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
-        }
-    } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+    } else if (run_end) {
+        if (!qp_internal_mirrored_spans_impl(device, centerx, centery, run_start, offsetx, offsety, false)) {
+            return false;
         }
-
-    } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
+        if (!qp_internal_mirrored_spans_impl(device, centerx, centery, run_start, offsetx, offsety, true)) {
+            return false;
         }
     }
 
@@ -133,7 +55,7 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
         return false;
     }
 
-    // plot the initial set of points for x, y and r
+    // start from the initial set of points for x, y and r
     int16_t xcalc = 0;
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
@@ -145,25 +67,39 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
         return false;
     }
 
-    bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-        ret = false;
-    }
-
-    if (ret) {
-        while (xcalc < ycalc) {
-            xcalc++;
-            if (err < 0) {
-                err += (xcalc << 1) + 1;
+    bool    ret       = true;
+    int16_t run_start = 0;
+    while (true) {
+        // Work out the next point, so we know whether the current run of offsety ends here
+        int16_t next_x   = xcalc;
+        int16_t next_y   = ycalc;
+        bool    last     = xcalc >= ycalc;
+        int16_t next_err = err;
+        if (!last) {
+            next_x++;
+            if (next_err < 0) {
+                next_err += (next_x << 1) + 1;
             } else {
-                ycalc--;
-                err += ((xcalc - ycalc) << 1) + 1;
-            }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-                ret = false;
-                break;
+                next_y--;
+                next_err += ((next_x - next_y) << 1) + 1;
             }
         }
+
+        bool run_end = last || next_y != ycalc;
+        if (!qp_circle_helper_impl(device, x, y, run_start, xcalc, ycalc, run_end, filled)) {
+            ret = false;
+            break;
+        }
+        if (last) {
+            break;
+        }
+        if (run_end) {
+            run_start = next_x;
+        }
+
+        xcalc = next_x;
+        ycalc = next_y;
+        err   = next_err;
     }
 
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
@@ -186,8 +186,6 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
-    qp_internal_fill_pixdata(device, 1, hue, sat, val);
-
     // draw angled line using Bresenham's algo
     int16_t x      = ((int16_t)x0);
     int16_t y      = ((int16_t)y0);
@@ -199,13 +197,18 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     int16_t e  = dx + dy;
     int16_t e2 = 2 * e;
 
+    // Runs can be as long as the major axis
+    qp_internal_fill_pixdata(device, MAX(dx, -dy) + 1, hue, sat, val);
+
+    // Consecutive pixels sharing a row or column are gathered into a single run, and sent as one viewport+pixdata
+    int16_t run_x = x;
+    int16_t run_y = y;
+
     bool ret = true;
     while (x != x1 || y != y1) {
-        if (!qp_internal_setpixel_impl(device, x, y)) {
-            ret = false;
-            break;
-        }
-        e2 = 2 * e;
+        int16_t prev_x = x;
+        int16_t prev_y = y;
+        e2             = 2 * e;
         if (e2 >= dy) {
             e += dy;
             x += slopex;
@@ -214,9 +217,17 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
             e += dx;
             y += slopey;
         }
+        if (x != run_x && y != run_y) {
+            if (!qp_internal_fillrect_helper_impl(device, run_x, run_y, prev_x, prev_y)) {
+                ret = false;
+                break;
+            }
+            run_x = x;
+            run_y = y;
+        }
     }
-    // draw the last pixel
-    if (!qp_internal_setpixel_impl(device, x, y)) {
+    // draw the last run
+    if (ret && !qp_internal_fillrect_helper_impl(device, run_x, run_y, x, y)) {
         ret = false;
     }
 
@@ -228,6 +239,37 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_rect
 
+// Draws the spans [a0,a1] and [-a1,-a0] relative to the center, at +/-b on the other axis. Mirrored pairs touching the
+// center line are merged into a single span, and coincident rows/columns are only drawn once.
+bool qp_internal_mirrored_spans_impl(painter_device_t device, uint16_t centerx, uint16_t centery, int16_t a0, int16_t a1, int16_t b, bool vertical) {
+    int16_t spans[2][2] = {{a0, a1}, {-a1, -a0}};
+    uint8_t num_spans   = 2;
+    if (a0 == 0) {
+        spans[0][0] = -a1;
+        num_spans   = 1;
+    }
+
+    int16_t offsets[2]  = {b, -b};
+    uint8_t num_offsets = (b == 0) ? 1 : 2;
+
+    for (uint8_t o = 0; o < num_offsets; ++o) {
+        for (uint8_t s = 0; s < num_spans; ++s) {
+            bool ok;
+            if (vertical) {
+                int16_t x = ((int16_t)centerx) + offsets[o];
+                ok        = qp_internal_fillrect_helper_impl(device, x, ((int16_t)centery) + spans[s][0], x, ((int16_t)centery) + spans[s][1]);
+            } else {
+                int16_t y = ((int16_t)centery) + offsets[o];
+                ok        = qp_internal_fillrect_helper_impl(device, ((int16_t)centerx) + spans[s][0], y, ((int16_t)centerx) + spans[s][1], y);
+            }
+            if (!ok) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
     uint32_t          pixels_in_pixdata = qp_internal_num_pixels_in_buffer(device);
     painter_driver_t *driver            = (painter_driver_t *)device;
@@ -6,54 +6,25 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 4-way symmetry to draw an ellipse as spans
+static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, int16_t run_start, int16_t run_end, int16_t offset, bool vertical, bool filled) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    Consecutive points along the same row (in the first region) or column (in
+    the second region) are gathered into a run [run_start,run_end], which is
+    drawn as four mirrored spans each sent as a single viewport+pixdata.
 
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
+    For filled ellipses, each run instead becomes the pair of horizontal lines
+    spanning its widest point.
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
-
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-            return false;
-        }
+    if (filled) {
+        return vertical ? qp_internal_mirrored_spans_impl(device, centerx, centery, 0, offset, run_end, false) : qp_internal_mirrored_spans_impl(device, centerx, centery, 0, run_end, offset, false);
     }
-
-    return true;
+    return qp_internal_mirrored_spans_impl(device, centerx, centery, run_start, run_end, offset, vertical);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,39 +46,56 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, MAX(sizex, sizey), hue, sat, val);
+    qp_internal_fill_pixdata(device, (MAX(sizex, sizey) * 2) + 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
+    bool    ret       = true;
+    int16_t run_start = 0;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+        int16_t curr_dy = dy;
         if (delta >= 0) {
             delta += fa * (1 - dy);
             dy--;
         }
         delta += bb * (4 * dx + 6);
+
+        // The run along this row ends when either dy changes or we move to the second region
+        if (dy != curr_dy || bb * (dx + 1) > aa * dy) {
+            if (!qp_ellipse_helper_impl(device, x, y, run_start, dx, curr_dy, false, filled)) {
+                ret = false;
+                break;
+            }
+            run_start = dx + 1;
+        }
     }
 
-    dx = sizex;
-    dy = 0;
+    dx        = sizex;
+    dy        = 0;
+    run_start = 0;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); ret && aa * dy <= bb * dx; dy++) {
+        int16_t curr_dx = dx;
         if (delta >= 0) {
             delta += fb * (1 - dx);
             dx--;
         }
         delta += aa * (4 * dy + 6);
+
+        // Filled ellipses get a line on every row here, outlines only need a span once dx changes
+        if (filled) {
+            if (!qp_ellipse_helper_impl(device, x, y, dy, dy, curr_dx, true, true)) {
+                ret = false;
+            }
+        } else if (dx != curr_dx || aa * (dy + 1) > bb * dx) {
+            if (!qp_ellipse_helper_impl(device, x, y, run_start, dy, curr_dx, true, false)) {
+                ret = false;
+            }
+            run_start = dy + 1;
+        }
     }
 
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
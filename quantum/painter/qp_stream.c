@@ -164,3 +164,155 @@ qp_file_stream_t qp_make_file_stream(FILE *f) {
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
+#    include "compiler_support.h"
+#    include "flash.h"
+
+STATIC_ASSERT((QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE & (QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1)) == 0, "QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE must be a power of two");
+STATIC_ASSERT(QUANTUM_PAINTER_FLASH_CACHE_BLOCKS > 0 && QUANTUM_PAINTER_FLASH_CACHE_BLOCKS < 256, "QUANTUM_PAINTER_FLASH_CACHE_BLOCKS must be between 1 and 255");
+
+// Read-ahead cache shared between all flash streams. Each miss fetches a whole block, so sequential pixel data reads
+// only touch the SPI bus once per block, while the remaining blocks keep descriptors/offset tables hot across seeks.
+typedef struct qp_flash_cache_block_t {
+    uint32_t address;
+    uint32_t last_used;
+    bool     valid;
+    uint8_t  data[QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE];
+} qp_flash_cache_block_t;
+
+static qp_flash_cache_block_t flash_cache[QUANTUM_PAINTER_FLASH_CACHE_BLOCKS] = {0};
+static uint32_t               flash_cache_counter                             = 0;
+static uint8_t                flash_cache_last_hit                            = 0;
+static bool                   flash_initialised                               = false;
+
+static qp_flash_cache_block_t *flash_cache_fetch(uint32_t address) {
+    uint32_t block_address = address & ~((uint32_t)(QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1));
+
+    // Fast path, sequential reads tend to hit the same block as last time
+    qp_flash_cache_block_t *block = &flash_cache[flash_cache_last_hit];
+    if (block->valid && block->address == block_address) {
+        return block;
+    }
+
+    // Search the cache, keeping track of the least recently used block in case we miss
+    uint8_t victim = 0;
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_BLOCKS; ++i) {
+        block = &flash_cache[i];
+        if (block->valid && block->address == block_address) {
+            block->last_used     = ++flash_cache_counter;
+            flash_cache_last_hit = i;
+            return block;
+        }
+        if (!block->valid || (flash_cache[victim].valid && block->last_used < flash_cache[victim].last_used)) {
+            victim = i;
+        }
+    }
+
+    // Cache miss, pull in the whole block
+    block = &flash_cache[victim];
+    if (flash_read_range(block_address, block->data, QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE) != FLASH_STATUS_SUCCESS) {
+        qp_dprintf("qp_flash_stream: fail (could not read flash at 0x%08X)\n", (int)block_address);
+        block->valid = false;
+        return NULL;
+    }
+
+    block->address       = block_address;
+    block->last_used     = ++flash_cache_counter;
+    block->valid         = true;
+    flash_cache_last_hit = victim;
+    return block;
+}
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    uint32_t                address = s->address + s->position;
+    qp_flash_cache_block_t *block   = flash_cache_fetch(address);
+    if (!block) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    ++s->position;
+    return block->data[address & (QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1)];
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Assets are written to external flash ahead of time, streams are read-only.
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // Same bounds semantics as memory streams
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op, cached blocks remain valid as the underlying flash is not modified.
+}
+
+void qp_flash_stream_invalidate_cache(void) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_BLOCKS; ++i) {
+        flash_cache[i].valid = false;
+    }
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    if (!flash_initialised) {
+        flash_init();
+        flash_initialised = true;
+    }
+
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+#endif // QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
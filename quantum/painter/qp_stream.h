@@ -83,3 +83,23 @@ typedef struct qp_file_stream_t {
 qp_file_stream_t qp_make_file_stream(FILE *f);
 
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address;
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+} qp_flash_stream_t;
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+// Drops all cached blocks, needed only if the assets in external flash are rewritten at runtime
+void qp_flash_stream_invalidate_cache(void);
+
+#endif // QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
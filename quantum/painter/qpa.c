@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Quantum Painter Asset "QPA" table format.
+// See https://docs.qmk.fm/quantum_painter#quantum-painter-external-flash for more information.
+
+#include "qpa.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QPA API
+
+bool qpa_read_table_descriptor(qp_stream_t *stream, uint16_t *asset_count, uint32_t *total_bytes) {
+    // Seek to the start
+    qp_stream_setpos(stream, 0);
+
+    // Read and validate the table descriptor
+    qpa_table_descriptor_v1_t table_descriptor;
+    if (qp_stream_read(&table_descriptor, sizeof(qpa_table_descriptor_v1_t), 1, stream) != 1) {
+        qp_dprintf("Failed to read table_descriptor, expected length was not %d\n", (int)sizeof(qpa_table_descriptor_v1_t));
+        return false;
+    }
+
+    // Make sure this block is valid
+    if (!qgf_validate_block_header(&table_descriptor.header, QPA_TABLE_DESCRIPTOR_TYPEID, (sizeof(qpa_table_descriptor_v1_t) - sizeof(qgf_block_header_v1_t)))) {
+        return false;
+    }
+
+    // Make sure the magic and version are correct
+    if (table_descriptor.magic != QPA_MAGIC || table_descriptor.qpa_version != 0x01) {
+        qp_dprintf("Failed to validate table_descriptor, expected magic 0x%06X was 0x%06X, expected version = 0x%02X was 0x%02X\n", (int)QPA_MAGIC, (int)table_descriptor.magic, (int)0x01, (int)table_descriptor.qpa_version);
+        return false;
+    }
+
+    // Make sure the file length is valid
+    if (table_descriptor.neg_total_file_size != ~table_descriptor.total_file_size) {
+        qp_dprintf("Failed to validate table_descriptor, expected negated length 0x%08X was 0x%08X\n", (int)(~table_descriptor.total_file_size), (int)table_descriptor.neg_total_file_size);
+        return false;
+    }
+
+    // Copy out the required info
+    if (asset_count) {
+        *asset_count = table_descriptor.asset_count;
+    }
+    if (total_bytes) {
+        *total_bytes = table_descriptor.total_file_size;
+    }
+
+    return true;
+}
+
+bool qpa_read_asset_offset(qp_stream_t *stream, uint16_t asset_count, uint16_t asset_index, uint32_t *asset_offset) {
+    // The asset offsets descriptor follows straight after the table descriptor
+    qp_stream_setpos(stream, sizeof(qpa_table_descriptor_v1_t));
+
+    // Read the asset offsets descriptor
+    qpa_asset_offsets_v1_t asset_offsets;
+    if (qp_stream_read(&asset_offsets, sizeof(qpa_asset_offsets_v1_t), 1, stream) != 1) {
+        qp_dprintf("Failed to read asset_offsets, expected length was not %d\n", (int)sizeof(qpa_asset_offsets_v1_t));
+        return false;
+    }
+
+    // Make sure this block is valid
+    if (!qgf_validate_block_header(&asset_offsets.header, QPA_ASSET_OFFSET_DESCRIPTOR_TYPEID, (asset_count * sizeof(uint32_t)))) {
+        return false;
+    }
+
+    if (asset_index >= asset_count) {
+        qp_dprintf("Invalid asset index, was %d but only %d assets in table\n", (int)asset_index, (int)asset_count);
+        return false;
+    }
+
+    // Skip the necessary amount of data to get to the requested asset offset
+    qp_stream_seek(stream, asset_index * sizeof(uint32_t), SEEK_CUR);
+
+    // Read the asset offset
+    uint32_t offset = 0;
+    if (qp_stream_read(&offset, sizeof(uint32_t), 1, stream) != 1) {
+        qp_dprintf("Failed to read asset offset, expected length was not %d\n", (int)sizeof(uint32_t));
+        return false;
+    }
+
+    // Copy out the required info
+    if (asset_offset) {
+        *asset_offset = offset;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_flash_asset_address
+
+uint32_t qp_flash_asset_address(uint16_t asset_index) {
+    qp_flash_stream_t stream = qp_make_flash_stream(QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS, sizeof(qpa_table_descriptor_v1_t));
+
+    // Now that the descriptor is readable, widen the stream to the whole table
+    uint16_t asset_count;
+    uint32_t total_size;
+    if (!qpa_read_table_descriptor((qp_stream_t *)&stream, &asset_count, &total_size)) {
+        qp_dprintf("qp_flash_asset_address: fail (invalid asset table)\n");
+        return QP_FLASH_ASSET_INVALID;
+    }
+    stream.length = total_size;
+
+    uint32_t offset;
+    if (!qpa_read_asset_offset((qp_stream_t *)&stream, asset_count, asset_index, &offset)) {
+        qp_dprintf("qp_flash_asset_address: fail (could not read offset for asset %d)\n", (int)asset_index);
+        return QP_FLASH_ASSET_INVALID;
+    }
+
+    return QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS + offset;
+}
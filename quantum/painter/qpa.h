@@ -0,0 +1,54 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Quantum Painter Asset "QPA" table format, used for packing QGF/QFF assets into external flash.
+// See https://docs.qmk.fm/quantum_painter#quantum-painter-external-flash for more information.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "compiler_support.h"
+#include "qp_stream.h"
+#include "qp_internal.h"
+#include "qgf.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QPA structures
+
+/////////////////////////////////////////
+// Asset table descriptor
+
+#define QPA_TABLE_DESCRIPTOR_TYPEID 0x10
+
+typedef struct PACKED qpa_table_descriptor_v1_t {
+    qgf_block_header_v1_t header;              // = { .type_id = 0x10, .neg_type_id = (~0x10), .length = 14 }
+    uint32_t              magic : 24;          // constant, equal to 0x415051 ("QPA")
+    uint8_t               qpa_version;         // constant, equal to 0x01
+    uint32_t              total_file_size;     // total size of the entire blob, starting at offset zero
+    uint32_t              neg_total_file_size; // negated value of total_file_size
+    uint16_t              asset_count;         // number of assets in the table
+} qpa_table_descriptor_v1_t;
+
+STATIC_ASSERT(sizeof(qpa_table_descriptor_v1_t) == (sizeof(qgf_block_header_v1_t) + 14), "qpa_table_descriptor_v1_t must be 19 bytes in v1 of QPA");
+
+#define QPA_MAGIC 0x415051
+
+/////////////////////////////////////////
+// Asset offsets descriptor
+
+#define QPA_ASSET_OFFSET_DESCRIPTOR_TYPEID 0x11
+
+typedef struct PACKED qpa_asset_offsets_v1_t {
+    qgf_block_header_v1_t header;    // = { .type_id = 0x11, .neg_type_id = (~0x11), .length = (N * sizeof(uint32_t)) }
+    uint32_t              offset[0]; // '0' signifies that this struct is immediately followed by the asset offsets, relative to the start of the table
+} qpa_asset_offsets_v1_t;
+
+STATIC_ASSERT(sizeof(qpa_asset_offsets_v1_t) == sizeof(qgf_block_header_v1_t), "qpa_asset_offsets_v1_t must only contain qgf_block_header_v1_t in v1 of QPA");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QPA API
+
+bool qpa_read_table_descriptor(qp_stream_t *stream, uint16_t *asset_count, uint32_t *total_bytes);
+bool qpa_read_asset_offset(qp_stream_t *stream, uint16_t asset_count, uint16_t asset_index, uint32_t *asset_offset);
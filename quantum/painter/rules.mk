@@ -1,6 +1,7 @@
 # Quantum Painter Configurables
 QUANTUM_PAINTER_DRIVERS ?=
 QUANTUM_PAINTER_ANIMATIONS_ENABLE ?= yes
+QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE ?= no
 
 QUANTUM_PAINTER_LVGL_INTEGRATION ?= no
 
@@ -49,6 +50,13 @@ ifeq ($(strip $(QUANTUM_PAINTER_ANIMATIONS_ENABLE)), yes)
     OPT_DEFS += -DQUANTUM_PAINTER_ANIMATIONS_ENABLE
 endif
 
+# Check if people want to load assets from external flash... enable the flash driver if so.
+ifeq ($(strip $(QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE)), yes)
+    FLASH_DRIVER ?= spi
+    OPT_DEFS += -DQUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qpa.c
+endif
+
 # Comms flags
 QUANTUM_PAINTER_NEEDS_COMMS_DUMMY ?= no
 QUANTUM_PAINTER_NEEDS_COMMS_SPI ?= no
@@ -246,6 +254,7 @@ ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_SURFACE)), yes)
         $(DRIVER_PATH)/painter/generic
     SRC += \
         $(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+        $(DRIVER_PATH)/painter/generic/qp_surface_compositor.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_rgb888.c
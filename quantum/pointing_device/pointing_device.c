@@ -57,6 +57,34 @@ void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
     shared_mouse_report = new_mouse_report;
 }
 
+/**
+ * @brief Adds motion from the other side to the shared mouse report
+ *
+ * The motion is kept until the pointing device task has used it, so the other side can be read more often than the
+ * task runs without losing counts. Buttons are replaced.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @param[in] new_mouse_report report_mouse_t
+ * @return false if the motion does not fit next to motion not used yet, only the buttons are taken then
+ */
+bool pointing_device_add_shared_report(report_mouse_t new_mouse_report) {
+    int32_t x = (int32_t)shared_mouse_report.x + new_mouse_report.x;
+    int32_t y = (int32_t)shared_mouse_report.y + new_mouse_report.y;
+    int32_t h = (int32_t)shared_mouse_report.h + new_mouse_report.h;
+    int32_t v = (int32_t)shared_mouse_report.v + new_mouse_report.v;
+
+    shared_mouse_report.buttons = new_mouse_report.buttons;
+    if (x != CONSTRAIN_HID_XY(x) || y != CONSTRAIN_HID_XY(y) || h < MOUSE_REPORT_HV_MIN || h > MOUSE_REPORT_HV_MAX || v < MOUSE_REPORT_HV_MIN || v > MOUSE_REPORT_HV_MAX) {
+        return false;
+    }
+    shared_mouse_report.x = x;
+    shared_mouse_report.y = y;
+    shared_mouse_report.h = h;
+    shared_mouse_report.v = v;
+    return true;
+}
+
 /**
  * @brief Gets current pointing device CPI if supported
  *
@@ -194,8 +222,14 @@ __attribute__((weak)) void pointing_device_init(void) {
 #    else
         gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN);
 #    endif
+#endif
+#ifdef POINTING_DEVICE_SAMPLER_ENABLE
+        pointing_device_sampler_init();
 #endif
     }
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    pointing_device_accel_init();
+#endif
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
     hires_scroll_resolution = POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER;
     for (int i = 0; i < POINTING_DEVICE_HIRES_SCROLL_EXPONENT; i++) {
@@ -230,6 +264,68 @@ void pointing_device_set_status(pointing_device_status_t status) {
     pointing_device_status = status;
 }
 
+#ifdef POINTING_DEVICE_SAMPLER_ENABLE
+/**
+ * @brief Reads the pointing device driver into the sampler
+ *
+ * Called every pointing device task by default. It may instead be called from a timer or thread when
+ * POINTING_DEVICE_SAMPLER_THREAD is defined, or by keyboard code, as long as it is always the same context and the
+ * sensor does not share its bus with anything used by the main loop.
+ */
+void pointing_device_sample(void) {
+    static uint8_t driver_buttons = 0;
+
+#    if defined(SPLIT_POINTING_ENABLE)
+    if (!(POINTING_DEVICE_THIS_SIDE)) {
+        return;
+    }
+#    endif
+    if (pointing_device_status != POINTING_DEVICE_STATUS_SUCCESS) {
+        return;
+    }
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        else
+    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        endif
+        return;
+    }
+#    endif
+
+    pointing_device_lock();
+    report_mouse_t report = pointing_device_driver->get_report((report_mouse_t){.buttons = driver_buttons});
+    pointing_device_unlock();
+
+    pointing_device_sample_t sample = {
+        .time            = timer_read(),
+        .x               = report.x,
+        .y               = report.y,
+        .h               = report.h,
+        .v               = report.v,
+        .buttons         = report.buttons,
+        .buttons_changed = report.buttons ^ driver_buttons,
+    };
+    driver_buttons = report.buttons;
+
+    pointing_device_sampler_push(&sample);
+}
+#endif // POINTING_DEVICE_SAMPLER_ENABLE
+
+/**
+ * @brief Reads the motion since the last report from the sampler, or directly from the driver
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t
+ */
+static report_mouse_t pointing_device_read(report_mouse_t mouse_report) {
+#ifdef POINTING_DEVICE_SAMPLER_ENABLE
+    return pointing_device_sampler_consume(mouse_report);
+#else
+    return pointing_device_driver->get_report(mouse_report);
+#endif
+}
+
 /**
  * @brief Sends processed mouse report to host
  *
@@ -303,6 +399,11 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
+#if defined(POINTING_DEVICE_SAMPLER_ENABLE) && !defined(POINTING_DEVICE_SAMPLER_THREAD)
+    // Sample on every run, even when reports are throttled
+    pointing_device_sample();
+#endif
+
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
@@ -316,7 +417,7 @@ __attribute__((weak)) bool pointing_device_task(void) {
     }
 
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
+#if defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_SAMPLER_ENABLE)
 #    if defined(SPLIT_POINTING_ENABLE)
 #        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
 #    endif
@@ -332,18 +433,18 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #    if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
-        local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
+        local_mouse_report         = pointing_device_read(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
 #    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
-        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_read(local_mouse_report) : shared_mouse_report;
 #    else
 #        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
 #    endif
 #else
-    local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
+    local_mouse_report = pointing_device_read(local_mouse_report);
 #endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#if defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_SAMPLER_ENABLE)
     }
 #endif
 
@@ -359,6 +460,16 @@ __attribute__((weak)) bool pointing_device_task(void) {
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#endif
+#if defined(SPLIT_POINTING_ENABLE)
+    // Motion from the other side is used once, the split transport adds more as it arrives
+    shared_mouse_report.x = 0;
+    shared_mouse_report.y = 0;
+    shared_mouse_report.h = 0;
+    shared_mouse_report.v = 0;
+#endif
+#ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+    local_mouse_report = pointing_device_subpixel_task(local_mouse_report);
 #endif
     local_mouse_report = pointing_device_task_modules(local_mouse_report);
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
@@ -406,10 +517,14 @@ void pointing_device_set_report(report_mouse_t mouse_report) {
  */
 uint16_t pointing_device_get_cpi(void) {
 #if defined(SPLIT_POINTING_ENABLE)
-    return POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_cpi() : shared_cpi;
-#else
-    return pointing_device_driver->get_cpi();
+    if (!(POINTING_DEVICE_THIS_SIDE)) {
+        return shared_cpi;
+    }
 #endif
+    pointing_device_lock();
+    uint16_t cpi = pointing_device_driver->get_cpi();
+    pointing_device_unlock();
+    return cpi;
 }
 
 /**
@@ -421,14 +536,14 @@ uint16_t pointing_device_get_cpi(void) {
  */
 void pointing_device_set_cpi(uint16_t cpi) {
 #if defined(SPLIT_POINTING_ENABLE)
-    if (POINTING_DEVICE_THIS_SIDE) {
-        pointing_device_driver->set_cpi(cpi);
-    } else {
+    if (!(POINTING_DEVICE_THIS_SIDE)) {
         shared_cpi = cpi;
+        return;
     }
-#else
-    pointing_device_driver->set_cpi(cpi);
 #endif
+    pointing_device_lock();
+    pointing_device_driver->set_cpi(cpi);
+    pointing_device_unlock();
 }
 
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -445,7 +560,9 @@ void pointing_device_set_cpi(uint16_t cpi) {
 void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
     bool local = (is_keyboard_left() == left);
     if (local) {
+        pointing_device_lock();
         pointing_device_driver->set_cpi(cpi);
+        pointing_device_unlock();
     } else {
         shared_cpi = cpi;
     }
@@ -33,6 +33,35 @@ typedef struct {
 #    include "pointing_device_auto_mouse.h"
 #endif
 
+#ifdef POINTING_DEVICE_SAMPLER_ENABLE
+#    include "pointing_device_sampler.h"
+#endif
+
+// Serialises calls into the driver with the sampling thread, which reads the sensor while the main loop is running
+#if defined(POINTING_DEVICE_SAMPLER_ENABLE) && defined(POINTING_DEVICE_SAMPLER_THREAD)
+void pointing_device_lock(void);
+void pointing_device_unlock(void);
+#else
+static inline void pointing_device_lock(void) {}
+static inline void pointing_device_unlock(void) {}
+#endif
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    include "pointing_device_accel.h"
+#endif
+
+#ifdef POINTING_DEVICE_KINETIC_ENABLE
+#    include "pointing_device_kinetic.h"
+#endif
+
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+#    include "pointing_device_touch.h"
+#endif
+
+#ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+#    include "pointing_device_subpixel.h"
+#endif
+
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
 #    define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
@@ -142,6 +171,7 @@ uint16_t pointing_device_get_hires_scroll_resolution(void);
 
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
+bool     pointing_device_add_shared_report(report_mouse_t report);
 uint16_t pointing_device_get_shared_cpi(void);
 #    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
@@ -0,0 +1,144 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device.h"
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+
+#    include "eeconfig.h"
+#    include "progmem.h"
+#    include "timer.h"
+
+// Points along each curve, the gain is interpolated linearly between them
+#    define ACCEL_LUT_SIZE 33
+
+// Curve shapes, rising from 0 to 1 as t goes from the offset speed (0) to the limit speed (1)
+#    define ACCEL_SHAPE_LINEAR(t) (t)
+#    define ACCEL_SHAPE_POWER(t) ((t) * (t))
+#    define ACCEL_SHAPE_SIGMOID(t) ((t) * (t) * (3.0 - 2.0 * (t)))
+#    define ACCEL_SHAPE_NATURAL(t) (1.0 - (1.0 - (t)) * (1.0 - (t)) * (1.0 - (t)))
+
+// Evaluated by the compiler, so that no floating point code ends up in the firmware
+#    define ACCEL_POINT(shape, i) ((uint16_t)(shape((i) / (double)(ACCEL_LUT_SIZE - 1)) * UINT16_MAX + 0.5))
+#    define ACCEL_POINTS_8(shape, i) ACCEL_POINT(shape, i), ACCEL_POINT(shape, i + 1), ACCEL_POINT(shape, i + 2), ACCEL_POINT(shape, i + 3), ACCEL_POINT(shape, i + 4), ACCEL_POINT(shape, i + 5), ACCEL_POINT(shape, i + 6), ACCEL_POINT(shape, i + 7)
+#    define ACCEL_LUT(shape) {ACCEL_POINTS_8(shape, 0), ACCEL_POINTS_8(shape, 8), ACCEL_POINTS_8(shape, 16), ACCEL_POINTS_8(shape, 24), ACCEL_POINT(shape, 32)}
+
+static const uint16_t PROGMEM accel_curves[POINTING_DEVICE_ACCEL_CURVE_COUNT - 1][ACCEL_LUT_SIZE] = {
+    [POINTING_DEVICE_ACCEL_LINEAR - 1]  = ACCEL_LUT(ACCEL_SHAPE_LINEAR),
+    [POINTING_DEVICE_ACCEL_POWER - 1]   = ACCEL_LUT(ACCEL_SHAPE_POWER),
+    [POINTING_DEVICE_ACCEL_SIGMOID - 1] = ACCEL_LUT(ACCEL_SHAPE_SIGMOID),
+    [POINTING_DEVICE_ACCEL_NATURAL - 1] = ACCEL_LUT(ACCEL_SHAPE_NATURAL),
+};
+
+static pointing_device_accel_config_t accel_config;
+static uint32_t                       last_motion_time = 0;
+
+void eeconfig_update_pointing_device_accel_default(void) {
+    accel_config = (pointing_device_accel_config_t){
+        .curve  = POINTING_DEVICE_ACCEL_CURVE_DEFAULT,
+        .gain   = POINTING_DEVICE_ACCEL_GAIN_DEFAULT,
+        .offset = POINTING_DEVICE_ACCEL_OFFSET_DEFAULT,
+        .limit  = POINTING_DEVICE_ACCEL_LIMIT_DEFAULT,
+    };
+    eeconfig_update_pointing_device_accel(&accel_config);
+}
+
+/**
+ * @brief Loads the acceleration settings from EEPROM
+ */
+void pointing_device_accel_init(void) {
+    eeconfig_read_pointing_device_accel(&accel_config);
+    if (accel_config.curve >= POINTING_DEVICE_ACCEL_CURVE_COUNT) {
+        eeconfig_update_pointing_device_accel_default();
+    }
+    last_motion_time = timer_read32();
+}
+
+pointing_device_accel_config_t pointing_device_accel_get_config(void) {
+    return accel_config;
+}
+
+/**
+ * @brief Changes the acceleration settings without saving them to EEPROM
+ *
+ * @param[in] config pointing_device_accel_config_t, an unknown curve disables acceleration
+ */
+void pointing_device_accel_set_config_noeeprom(pointing_device_accel_config_t config) {
+    if (config.curve >= POINTING_DEVICE_ACCEL_CURVE_COUNT) {
+        config.curve = POINTING_DEVICE_ACCEL_NONE;
+    }
+    accel_config = config;
+}
+
+/**
+ * @brief Changes the acceleration settings and saves them to EEPROM
+ *
+ * @param[in] config pointing_device_accel_config_t
+ */
+void pointing_device_accel_set_config(pointing_device_accel_config_t config) {
+    pointing_device_accel_set_config_noeeprom(config);
+    eeconfig_update_pointing_device_accel(&accel_config);
+}
+
+/**
+ * @brief Looks up the gain of the current curve for the given speed
+ *
+ * @param[in] speed pd_fixed_t in counts per millisecond
+ * @return pd_fixed_t gain, from 1 up to 1 + gain / 16
+ */
+pd_fixed_t pointing_device_accel_gain(pd_fixed_t speed) {
+    pd_fixed_t offset = PD_FIXED_FROM_INT(accel_config.offset);
+    pd_fixed_t limit  = PD_FIXED_FROM_INT(accel_config.limit);
+
+    if (accel_config.curve == POINTING_DEVICE_ACCEL_NONE || accel_config.gain == 0 || speed <= offset) {
+        return PD_FIXED_ONE;
+    }
+
+    // Position along the curve, from 0 at the offset to 1 at the limit
+    pd_fixed_t t = (speed >= limit || limit <= offset) ? PD_FIXED_ONE : pd_fixed_div(speed - offset, limit - offset);
+
+    const uint16_t *lut      = accel_curves[accel_config.curve - 1];
+    uint32_t        position = (uint32_t)t * (ACCEL_LUT_SIZE - 1);
+    uint8_t         index    = position >> PD_FIXED_SHIFT;
+    uint32_t        shape    = pgm_read_word(&lut[index]);
+    if (index < ACCEL_LUT_SIZE - 1) {
+        uint32_t next = pgm_read_word(&lut[index + 1]);
+        uint32_t frac = position & (PD_FIXED_ONE - 1);
+        shape         = next >= shape ? shape + (((next - shape) * frac) >> PD_FIXED_SHIFT) : shape - (((shape - next) * frac) >> PD_FIXED_SHIFT);
+    }
+
+    // Extra gain is in sixteenths, i.e. 12 fractional bits
+    pd_fixed_t extra = (pd_fixed_t)accel_config.gain << (PD_FIXED_SHIFT - 4);
+    return PD_FIXED_ONE + (pd_fixed_t)(((int64_t)extra * shape) / UINT16_MAX);
+}
+
+/**
+ * @brief Accelerates motion by the speed it was made at
+ *
+ * The speed is measured over the time since the previous call, and the same gain is applied to both axes so that the
+ * direction of motion is kept. Scrolling is not accelerated.
+ *
+ * @param[in] motion pointing_device_motion_t
+ * @return pointing_device_motion_t accelerated motion
+ */
+pointing_device_motion_t pointing_device_accel_apply(pointing_device_motion_t motion) {
+    uint32_t elapsed = timer_elapsed32(last_motion_time);
+    last_motion_time = timer_read32();
+
+    if (motion.x == 0 && motion.y == 0) {
+        return motion;
+    }
+
+    // Distance approximated as max + 3/8 min, within 7% of the real one without a square root
+    uint32_t   ax       = motion.x < 0 ? -(uint32_t)motion.x : (uint32_t)motion.x;
+    uint32_t   ay       = motion.y < 0 ? -(uint32_t)motion.y : (uint32_t)motion.y;
+    uint32_t   distance = ax > ay ? ax + ((ay >> 3) * 3) : ay + ((ax >> 3) * 3);
+    pd_fixed_t speed    = MIN(distance / (elapsed ? elapsed : 1), INT32_MAX);
+
+    pd_fixed_t gain = pointing_device_accel_gain(speed);
+    motion.x        = pd_fixed_mul(motion.x, gain);
+    motion.y        = pd_fixed_mul(motion.y, gain);
+    return motion;
+}
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "compiler_support.h"
+
+#ifndef POINTING_DEVICE_ACCEL_ENABLE
+#    error "POINTING_DEVICE_ACCEL_ENABLE not defined! check config settings"
+#endif
+
+#include "pointing_device_subpixel.h"
+
+typedef enum {
+    POINTING_DEVICE_ACCEL_NONE,
+    POINTING_DEVICE_ACCEL_LINEAR,
+    POINTING_DEVICE_ACCEL_POWER,
+    POINTING_DEVICE_ACCEL_SIGMOID,
+    POINTING_DEVICE_ACCEL_NATURAL,
+    POINTING_DEVICE_ACCEL_CURVE_COUNT,
+} pointing_device_accel_curve_t;
+
+#ifndef POINTING_DEVICE_ACCEL_CURVE_DEFAULT
+#    define POINTING_DEVICE_ACCEL_CURVE_DEFAULT POINTING_DEVICE_ACCEL_NATURAL
+#endif
+
+// Extra gain at full speed, in sixteenths: 32 multiplies fast motion by 1 + 32 / 16 = 3
+#ifndef POINTING_DEVICE_ACCEL_GAIN_DEFAULT
+#    define POINTING_DEVICE_ACCEL_GAIN_DEFAULT 32
+#endif
+
+// Speed in counts per millisecond below which motion is not accelerated
+#ifndef POINTING_DEVICE_ACCEL_OFFSET_DEFAULT
+#    define POINTING_DEVICE_ACCEL_OFFSET_DEFAULT 1
+#endif
+
+// Speed in counts per millisecond at which the full gain is reached
+#ifndef POINTING_DEVICE_ACCEL_LIMIT_DEFAULT
+#    define POINTING_DEVICE_ACCEL_LIMIT_DEFAULT 32
+#endif
+
+typedef union pointing_device_accel_config_t {
+    uint32_t raw;
+    struct PACKED {
+        uint8_t curve;  // pointing_device_accel_curve_t
+        uint8_t gain;   // extra gain at full speed, in sixteenths
+        uint8_t offset; // counts per millisecond
+        uint8_t limit;  // counts per millisecond
+    };
+} PACKED pointing_device_accel_config_t;
+
+STATIC_ASSERT(sizeof(pointing_device_accel_config_t) == sizeof(uint32_t), "Pointing device acceleration EECONFIG out of spec.");
+
+void                           pointing_device_accel_init(void);
+pointing_device_accel_config_t pointing_device_accel_get_config(void);
+void                           pointing_device_accel_set_config(pointing_device_accel_config_t config);
+void                           pointing_device_accel_set_config_noeeprom(pointing_device_accel_config_t config);
+pd_fixed_t                     pointing_device_accel_gain(pd_fixed_t speed);
+pointing_device_motion_t       pointing_device_accel_apply(pointing_device_motion_t motion);
+void                           eeconfig_update_pointing_device_accel_default(void);
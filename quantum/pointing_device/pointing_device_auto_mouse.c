@@ -17,10 +17,11 @@
 
 #ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
 
-#    include <stdlib.h>
 #    include <string.h>
 #    include "pointing_device_auto_mouse.h"
 #    include "debug.h"
+#    include "timer.h"
+#    include "util.h"
 #    include "action_util.h"
 #    include "quantum_keycodes.h"
 
@@ -110,13 +111,14 @@ int8_t get_auto_mouse_key_tracker(void) {
 /**
  * @brief Reset auto mouse context
  *
- * Clear timers and status
+ * Clear timers, status and recent motion
  *
  * NOTE: this will set is_toggled to false so careful when using it
  */
 static void auto_mouse_reset(void) {
     memset(&auto_mouse_context.status, 0, sizeof(auto_mouse_context.status));
     memset(&auto_mouse_context.timer, 0, sizeof(auto_mouse_context.timer));
+    memset(&auto_mouse_context.motion, 0, sizeof(auto_mouse_context.motion));
 }
 
 /**
@@ -236,11 +238,58 @@ void auto_mouse_layer_off(void) {
  * @return bool of pointing_device activation
  */
 __attribute__((weak)) bool auto_mouse_activation(report_mouse_t mouse_report) {
-    auto_mouse_context.total_mouse_movement.x += mouse_report.x;
-    auto_mouse_context.total_mouse_movement.y += mouse_report.y;
-    auto_mouse_context.total_mouse_movement.h += mouse_report.h;
-    auto_mouse_context.total_mouse_movement.v += mouse_report.v;
-    return abs(auto_mouse_context.total_mouse_movement.x) > AUTO_MOUSE_THRESHOLD || abs(auto_mouse_context.total_mouse_movement.y) > AUTO_MOUSE_THRESHOLD || abs(auto_mouse_context.total_mouse_movement.h) > AUTO_MOUSE_THRESHOLD || abs(auto_mouse_context.total_mouse_movement.v) > AUTO_MOUSE_THRESHOLD || mouse_report.buttons;
+    // less motion keeps the layer on than turns it on, so that motion around the threshold does not flip it
+    uint16_t threshold = layer_state_is((AUTO_MOUSE_TARGET_LAYER)) ? AUTO_MOUSE_HOLD_THRESHOLD : AUTO_MOUSE_THRESHOLD;
+    return get_auto_mouse_motion() > threshold || mouse_report.buttons;
+}
+
+/* low-pass filter of one axis, signed so that jitter back and forth cancels out */
+static int32_t auto_mouse_filter(int32_t level, int16_t motion, uint16_t keep) {
+    level = level * keep / 256 + ((int32_t)motion << 8);
+    // far above any threshold, and keeps the product above in range
+    return level > (1L << 22) ? (1L << 22) : (level < -(1L << 22) ? -(1L << 22) : level);
+}
+
+/**
+ * @brief Adds a report to the motion filter
+ *
+ * Motion drains away over AUTO_MOUSE_WINDOW_MS, so that slow sensor drift never adds up to the threshold. Called
+ * with every report, including those without motion.
+ *
+ * @param[in] mouse_report report_mouse_t
+ */
+static void auto_mouse_motion_update(report_mouse_t mouse_report) {
+    uint16_t now     = timer_read();
+    uint16_t elapsed = MIN(TIMER_DIFF_16(now, auto_mouse_context.motion.time), AUTO_MOUSE_WINDOW_MS);
+    uint16_t keep    = ((uint32_t)(AUTO_MOUSE_WINDOW_MS - elapsed) << 8) / AUTO_MOUSE_WINDOW_MS;
+
+    auto_mouse_context.motion.time = now;
+    auto_mouse_context.motion.x    = auto_mouse_filter(auto_mouse_context.motion.x, mouse_report.x, keep);
+    auto_mouse_context.motion.y    = auto_mouse_filter(auto_mouse_context.motion.y, mouse_report.y, keep);
+    auto_mouse_context.motion.h    = auto_mouse_filter(auto_mouse_context.motion.h, mouse_report.h, keep);
+    auto_mouse_context.motion.v    = auto_mouse_filter(auto_mouse_context.motion.v, mouse_report.v, keep);
+}
+
+// Length approximated as max + 3/8 min, within 7% of the real one without a square root
+static uint32_t auto_mouse_length(int32_t a, int32_t b) {
+    uint32_t ua = a < 0 ? -a : a;
+    uint32_t ub = b < 0 ? -b : b;
+    return ua > ub ? ua + ((ub >> 3) * 3) : ub + ((ua >> 3) * 3);
+}
+
+/**
+ * @brief Get recent motion of the pointing device
+ *
+ * Cursor or scroll motion, whichever is larger, over about the last AUTO_MOUSE_WINDOW_MS, less AUTO_MOUSE_NOISE.
+ * Useful for custom auto_mouse_activation functions.
+ *
+ * @return uint16_t motion in counts
+ */
+uint16_t get_auto_mouse_motion(void) {
+    uint32_t cursor = auto_mouse_length(auto_mouse_context.motion.x, auto_mouse_context.motion.y);
+    uint32_t scroll = auto_mouse_length(auto_mouse_context.motion.h, auto_mouse_context.motion.v);
+    uint32_t motion = MAX(cursor, scroll) >> 8;
+    return motion > AUTO_MOUSE_NOISE ? MIN(motion - AUTO_MOUSE_NOISE, UINT16_MAX) : 0;
 }
 
 /**
@@ -251,6 +300,10 @@ __attribute__((weak)) bool auto_mouse_activation(report_mouse_t mouse_report) {
  * @param[in] mouse_report report_mouse_t
  */
 void pointing_device_task_auto_mouse(report_mouse_t mouse_report) {
+    // the filter follows every report, also while activation is not checked
+    if (AUTO_MOUSE_ENABLED) {
+        auto_mouse_motion_update(mouse_report);
+    }
     // skip if disabled, delay timer running, or debounce
     if (!(AUTO_MOUSE_ENABLED) || timer_elapsed(auto_mouse_context.timer.active) <= auto_mouse_context.config.debounce || timer_elapsed(auto_mouse_context.timer.delay) <= AUTO_MOUSE_DELAY) {
         return;
@@ -258,16 +311,14 @@ void pointing_device_task_auto_mouse(report_mouse_t mouse_report) {
     // update activation and reset debounce
     auto_mouse_context.status.is_activated = auto_mouse_activation(mouse_report);
     if (is_auto_mouse_active()) {
-        auto_mouse_context.total_mouse_movement = (total_mouse_movement_t){.x = 0, .y = 0, .h = 0, .v = 0};
-        auto_mouse_context.timer.active         = timer_read();
-        auto_mouse_context.timer.delay          = 0;
+        auto_mouse_context.timer.active = timer_read();
+        auto_mouse_context.timer.delay  = 0;
         if (!layer_state_is((AUTO_MOUSE_TARGET_LAYER))) {
             layer_on((AUTO_MOUSE_TARGET_LAYER));
         }
     } else if (layer_state_is((AUTO_MOUSE_TARGET_LAYER)) && timer_elapsed(auto_mouse_context.timer.active) > auto_mouse_context.config.timeout) {
         layer_off((AUTO_MOUSE_TARGET_LAYER));
-        auto_mouse_context.timer.active         = 0;
-        auto_mouse_context.total_mouse_movement = (total_mouse_movement_t){.x = 0, .y = 0, .h = 0, .v = 0};
+        auto_mouse_context.timer.active = 0;
     }
 }
 
@@ -45,14 +45,30 @@
 #ifndef AUTO_MOUSE_THRESHOLD
 #    define AUTO_MOUSE_THRESHOLD 10
 #endif
+/* motion needed to keep the target layer on, lower than the threshold so the layer does not flicker */
+#ifndef AUTO_MOUSE_HOLD_THRESHOLD
+#    define AUTO_MOUSE_HOLD_THRESHOLD (AUTO_MOUSE_THRESHOLD / 2)
+#endif
+/* time over which motion adds up, older motion drains away */
+#ifndef AUTO_MOUSE_WINDOW_MS
+#    define AUTO_MOUSE_WINDOW_MS 100
+#endif
+/* motion within the window which is sensor noise, depending on the sensor */
+#ifndef AUTO_MOUSE_NOISE
+#    if defined(POINTING_DEVICE_DRIVER_analog_joystick) || defined(POINTING_DEVICE_DRIVER_azoteq_iqs5xx) || defined(POINTING_DEVICE_DRIVER_cirque_pinnacle_i2c) || defined(POINTING_DEVICE_DRIVER_cirque_pinnacle_spi)
+#        define AUTO_MOUSE_NOISE 4
+#    elif defined(POINTING_DEVICE_DRIVER_custom) || defined(POINTING_DEVICE_DRIVER_pimoroni_trackball)
+#        define AUTO_MOUSE_NOISE 0
+#    else
+#        define AUTO_MOUSE_NOISE 2
+#    endif
+#endif
+
+#if AUTO_MOUSE_WINDOW_MS < 1 || AUTO_MOUSE_WINDOW_MS > 10000
+#    error "AUTO_MOUSE_WINDOW_MS must be between 1 and 10000"
+#endif
 
 /* data structure */
-typedef struct {
-    mouse_xy_report_t x;
-    mouse_xy_report_t y;
-    int8_t            v;
-    int8_t            h;
-} total_mouse_movement_t;
 typedef struct {
     struct {
         bool     is_enabled;
@@ -69,7 +85,13 @@ typedef struct {
         bool   is_toggled;
         int8_t mouse_key_tracker;
     } status;
-    total_mouse_movement_t total_mouse_movement;
+    struct {
+        int32_t  x; // motion over about the last AUTO_MOUSE_WINDOW_MS, in 1/256 counts
+        int32_t  y;
+        int32_t  h;
+        int32_t  v;
+        uint16_t time;
+    } motion;
 } auto_mouse_context_t;
 
 /* ----------Set up and control------------------------------------------------------------------------------ */
@@ -87,7 +109,8 @@ void          auto_mouse_layer_off(void);                               // disab
 layer_state_t remove_auto_mouse_layer(layer_state_t state, bool force); // remove auto mouse target layer from state if appropriate (can be forced)
 bool          is_auto_mouse_active(void);                               // check if target layer is active
 /* ----------For custom pointing device activation----------------------------------------------------------- */
-bool auto_mouse_activation(report_mouse_t mouse_report); // handles pointing device trigger conditions for target layer activation (overwritable)
+bool     auto_mouse_activation(report_mouse_t mouse_report); // handles pointing device trigger conditions for target layer activation (overwritable)
+uint16_t get_auto_mouse_motion(void);                         // get recent motion above the sensor noise, in counts
 
 /* ----------Handling keyevents------------------------------------------------------------------------------ */
 void auto_mouse_keyevent(bool pressed);      // trigger auto mouse keyevent: mouse_keytracker increment/decrement on press/release
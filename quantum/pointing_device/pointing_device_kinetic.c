@@ -0,0 +1,206 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device.h"
+
+#ifdef POINTING_DEVICE_KINETIC_ENABLE
+
+#    include "progmem.h"
+#    include "timer.h"
+
+typedef enum {
+    KINETIC_CONTACT_UNKNOWN,
+    KINETIC_CONTACT_TOUCH,
+    KINETIC_CONTACT_LIFTED,
+} kinetic_contact_t;
+
+typedef struct {
+    pd_fixed_t a;           // velocity along the first axis, per millisecond
+    pd_fixed_t b;           // velocity along the second axis, per millisecond
+    uint16_t   last_motion; // time of the last report with motion
+    bool       tracking;    // moving, the velocity follows the reports
+    bool       gliding;     // released, the velocity decays
+} kinetic_channel_t;
+
+// 2^(-i/16) in Q16.16, the decay over i sixteenths of a half-life
+static const uint32_t PROGMEM kinetic_decay_lut[16] = {
+    65536, 62757, 60097, 57549, 55109, 52773, 50535, 48393, 46341, 44376, 42495, 40693, 38968, 37316, 35734, 34219,
+};
+
+static bool              kinetic_enabled = true;
+static volatile uint8_t  kinetic_contact = KINETIC_CONTACT_UNKNOWN;
+static kinetic_channel_t kinetic_cursor  = {0};
+static kinetic_channel_t kinetic_scroll  = {0};
+static uint16_t          kinetic_last_time;
+static uint8_t           kinetic_last_buttons;
+
+/**
+ * @brief Enables or disables cursor glide and scroll momentum
+ *
+ * @param[in] enable bool
+ */
+void pointing_device_kinetic_enable(bool enable) {
+    kinetic_enabled = enable;
+    pointing_device_kinetic_stop();
+}
+
+bool pointing_device_kinetic_is_enabled(void) {
+    return kinetic_enabled;
+}
+
+/**
+ * @brief Tells the kinetic engine whether a finger is on the sensor
+ *
+ * Drivers for sensors which can tell, e.g. touchpads, call this with every read. Gliding then starts as soon as the
+ * finger is lifted and stops when it touches again. Other sensors are considered released once they stop moving for
+ * POINTING_DEVICE_KINETIC_RELEASE_MS.
+ *
+ * @param[in] contact bool
+ */
+void pointing_device_kinetic_set_contact(bool contact) {
+    kinetic_contact = contact ? KINETIC_CONTACT_TOUCH : KINETIC_CONTACT_LIFTED;
+}
+
+/**
+ * @brief Stops gliding and scrolling immediately
+ *
+ * Contact is forgotten as well, until the driver reports it again.
+ */
+void pointing_device_kinetic_stop(void) {
+    kinetic_contact = KINETIC_CONTACT_UNKNOWN;
+    kinetic_cursor  = (kinetic_channel_t){0};
+    kinetic_scroll  = (kinetic_channel_t){0};
+}
+
+bool pointing_device_kinetic_is_gliding(void) {
+    return kinetic_cursor.gliding || kinetic_scroll.gliding;
+}
+
+/**
+ * @brief Slows a speed down by the given time
+ *
+ * The speed halves every half_life milliseconds, so decaying in several steps gives the same result as in one.
+ *
+ * @param[in] speed pd_fixed_t
+ * @param[in] elapsed milliseconds
+ * @param[in] half_life milliseconds, 0 stops immediately
+ * @return pd_fixed_t
+ */
+pd_fixed_t pointing_device_kinetic_decay(pd_fixed_t speed, uint16_t elapsed, uint16_t half_life) {
+    if (!half_life || elapsed / half_life > 30) {
+        return 0;
+    }
+    speed /= (pd_fixed_t)1 << (elapsed / half_life);
+
+    // What is left of a half-life: whole sixteenths from the table, the rest as e^(-x) with x = rest * ln(2) < 0.044,
+    // where three terms of the series are exact to Q16.16, so that many short steps do not drift from a long one
+    uint32_t fraction = (((uint32_t)(elapsed % half_life) << PD_FIXED_SHIFT) + half_life / 2) / half_life;
+    uint32_t x        = ((fraction & 0xFFF) * 45426UL + PD_FIXED_ONE / 2) >> PD_FIXED_SHIFT;
+    uint32_t x2       = (x * x) >> PD_FIXED_SHIFT;
+    uint32_t rest     = PD_FIXED_ONE - x + x2 / 2 - (x2 * x) / (6 * PD_FIXED_ONE);
+    uint32_t factor   = ((uint64_t)pgm_read_dword(&kinetic_decay_lut[fraction >> 12]) * rest + PD_FIXED_ONE / 2) >> PD_FIXED_SHIFT;
+    return pd_fixed_mul(speed, factor);
+}
+
+// Distance covered while slowing down by the given speed: the integral of the decay is speed * half_life / ln(2)
+static pd_fixed_t kinetic_distance(pd_fixed_t speed, uint16_t half_life) {
+    int64_t distance = ((int64_t)speed * half_life * PD_FIXED(1.4426950408889634)) / PD_FIXED_ONE;
+    return distance < INT32_MIN ? INT32_MIN : (distance > INT32_MAX ? INT32_MAX : distance);
+}
+
+// Speed approximated as max + 3/8 min, within 7% of the real one without a square root
+static pd_fixed_t kinetic_speed(const kinetic_channel_t *channel) {
+    uint32_t a = channel->a < 0 ? -(uint32_t)channel->a : (uint32_t)channel->a;
+    uint32_t b = channel->b < 0 ? -(uint32_t)channel->b : (uint32_t)channel->b;
+    return MIN(a > b ? a + ((b >> 3) * 3) : b + ((a >> 3) * 3), INT32_MAX);
+}
+
+static void kinetic_channel_task(kinetic_channel_t *channel, pd_fixed_t *a, pd_fixed_t *b, uint16_t now, uint16_t elapsed, uint16_t half_life, pd_fixed_t flick_speed) {
+    if (*a || *b) {
+        uint16_t since       = TIMER_DIFF_16(now, channel->last_motion);
+        channel->last_motion = now;
+        channel->gliding     = false;
+
+        if (!channel->tracking || since > POINTING_DEVICE_KINETIC_RELEASE_MS) {
+            // First report of a stroke, the time it covers is unknown
+            channel->a        = 0;
+            channel->b        = 0;
+            channel->tracking = true;
+            return;
+        }
+
+        // Smoothed, so that a single jittery report does not decide the glide
+        since      = since ? since : 1;
+        channel->a = channel->a / 2 + (*a / since) / 2;
+        channel->b = channel->b / 2 + (*b / since) / 2;
+        return;
+    }
+
+    if (channel->gliding) {
+        pd_fixed_t a0 = channel->a;
+        pd_fixed_t b0 = channel->b;
+        channel->a    = pointing_device_kinetic_decay(a0, elapsed, half_life);
+        channel->b    = pointing_device_kinetic_decay(b0, elapsed, half_life);
+        *a            = kinetic_distance(a0 - channel->a, half_life);
+        *b            = kinetic_distance(b0 - channel->b, half_life);
+
+        // Stop once what is left of the glide would not add up to a count
+        if (kinetic_distance(kinetic_speed(channel), half_life) < PD_FIXED_ONE / 2) {
+            *channel = (kinetic_channel_t){0};
+        }
+        return;
+    }
+
+    if (!channel->tracking) {
+        return;
+    }
+
+    uint16_t since = TIMER_DIFF_16(now, channel->last_motion);
+    if (kinetic_contact == KINETIC_CONTACT_TOUCH || (kinetic_contact == KINETIC_CONTACT_UNKNOWN && since < POINTING_DEVICE_KINETIC_RELEASE_MS)) {
+        // Held still, a later release should not glide
+        if (since > POINTING_DEVICE_KINETIC_RELEASE_MS) {
+            channel->tracking = false;
+        }
+        return;
+    }
+
+    // Released
+    channel->tracking = false;
+    if (half_life && kinetic_speed(channel) >= flick_speed) {
+        channel->gliding = true;
+        channel->a       = pointing_device_kinetic_decay(channel->a, since, half_life);
+        channel->b       = pointing_device_kinetic_decay(channel->b, since, half_life);
+    }
+}
+
+/**
+ * @brief Adds cursor glide and scroll momentum to motion
+ *
+ * Tracks the velocity of the reported motion, and keeps the cursor or scrolling going after a release at or above
+ * the flick speed. The velocity then decays exponentially with the time between reports, so gliding behaves the
+ * same at any report rate. New motion, a touch or a button change stops gliding.
+ *
+ * @param[in] motion pointing_device_motion_t
+ * @param[in] buttons of the current report
+ * @return pointing_device_motion_t with glide motion added
+ */
+pointing_device_motion_t pointing_device_kinetic_task(pointing_device_motion_t motion, uint8_t buttons) {
+    uint16_t now      = timer_read();
+    uint16_t elapsed  = TIMER_DIFF_16(now, kinetic_last_time);
+    kinetic_last_time = now;
+
+    if (!kinetic_enabled) {
+        return motion;
+    }
+    if (buttons != kinetic_last_buttons || kinetic_contact == KINETIC_CONTACT_TOUCH) {
+        kinetic_cursor.gliding = false;
+        kinetic_scroll.gliding = false;
+    }
+    kinetic_last_buttons = buttons;
+
+    kinetic_channel_task(&kinetic_cursor, &motion.x, &motion.y, now, elapsed, POINTING_DEVICE_KINETIC_GLIDE_HALF_LIFE_MS, PD_FIXED(POINTING_DEVICE_KINETIC_GLIDE_FLICK_SPEED));
+    kinetic_channel_task(&kinetic_scroll, &motion.h, &motion.v, now, elapsed, POINTING_DEVICE_KINETIC_SCROLL_HALF_LIFE_MS, pointing_device_scroll_from_notches(PD_FIXED(POINTING_DEVICE_KINETIC_SCROLL_FLICK_SPEED)));
+    return motion;
+}
+
+#endif // POINTING_DEVICE_KINETIC_ENABLE
@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef POINTING_DEVICE_KINETIC_ENABLE
+#    error "POINTING_DEVICE_KINETIC_ENABLE not defined! check config settings"
+#endif
+
+#include "pointing_device_subpixel.h"
+
+// Time in milliseconds for the cursor to lose half of its speed while gliding, 0 disables cursor glide
+#ifndef POINTING_DEVICE_KINETIC_GLIDE_HALF_LIFE_MS
+#    define POINTING_DEVICE_KINETIC_GLIDE_HALF_LIFE_MS 100
+#endif
+
+// Speed in counts per millisecond the cursor must be released at to glide
+#ifndef POINTING_DEVICE_KINETIC_GLIDE_FLICK_SPEED
+#    define POINTING_DEVICE_KINETIC_GLIDE_FLICK_SPEED 1.0
+#endif
+
+// Time in milliseconds for scrolling to lose half of its speed, 0 disables scroll momentum
+#ifndef POINTING_DEVICE_KINETIC_SCROLL_HALF_LIFE_MS
+#    define POINTING_DEVICE_KINETIC_SCROLL_HALF_LIFE_MS 250
+#endif
+
+// Speed in wheel notches per millisecond scrolling must be released at to keep going
+#ifndef POINTING_DEVICE_KINETIC_SCROLL_FLICK_SPEED
+#    define POINTING_DEVICE_KINETIC_SCROLL_FLICK_SPEED 0.01
+#endif
+
+// Time in milliseconds without motion after which a sensor that cannot report contact is considered released
+#ifndef POINTING_DEVICE_KINETIC_RELEASE_MS
+#    define POINTING_DEVICE_KINETIC_RELEASE_MS 20
+#endif
+
+void                     pointing_device_kinetic_enable(bool enable);
+bool                     pointing_device_kinetic_is_enabled(void);
+void                     pointing_device_kinetic_set_contact(bool contact);
+void                     pointing_device_kinetic_stop(void);
+bool                     pointing_device_kinetic_is_gliding(void);
+pd_fixed_t               pointing_device_kinetic_decay(pd_fixed_t speed, uint16_t elapsed, uint16_t half_life);
+pointing_device_motion_t pointing_device_kinetic_task(pointing_device_motion_t motion, uint8_t buttons);
@@ -0,0 +1,215 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_SAMPLER_ENABLE
+
+#    include "pointing_device.h"
+#    include "util.h"
+
+#    ifdef POINTING_DEVICE_SAMPLER_THREAD
+#        ifndef PROTOCOL_CHIBIOS
+#            error "POINTING_DEVICE_SAMPLER_THREAD is only supported on ChibiOS"
+#        endif
+#        include <ch.h>
+
+#        ifndef POINTING_DEVICE_SAMPLER_THREAD_STACK
+#            define POINTING_DEVICE_SAMPLER_THREAD_STACK 512
+#        endif
+#    endif
+
+#    define SAMPLER_INDEX_MASK (POINTING_DEVICE_SAMPLER_BUFFER_SIZE - 1)
+
+// Single producer, single consumer: only the sampling context moves the head, only pointing_device_task() moves the tail
+static pointing_device_sample_t sampler_buffer[POINTING_DEVICE_SAMPLER_BUFFER_SIZE];
+static uint8_t                  sampler_head = 0;
+static uint8_t                  sampler_tail = 0;
+
+// Owned by the producer, holds samples merged together while the buffer was full
+static pointing_device_sample_t sampler_pending;
+static bool                     sampler_has_pending = false;
+
+// Owned by the consumer
+static int32_t                         residual_x, residual_y, residual_h, residual_v;
+static uint16_t                        last_sample_time;
+static bool                            has_last_sample = false;
+static pointing_device_sampler_stats_t sampler_stats;
+
+static inline int16_t sampler_add(int16_t a, int16_t b) {
+    int32_t sum = (int32_t)a + b;
+    return sum < INT16_MIN ? INT16_MIN : (sum > INT16_MAX ? INT16_MAX : sum);
+}
+
+static void sampler_merge(pointing_device_sample_t *into, const pointing_device_sample_t *sample) {
+    into->time            = sample->time;
+    into->x               = sampler_add(into->x, sample->x);
+    into->y               = sampler_add(into->y, sample->y);
+    into->h               = sampler_add(into->h, sample->h);
+    into->v               = sampler_add(into->v, sample->v);
+    into->buttons         = (into->buttons & ~sample->buttons_changed) | (sample->buttons & sample->buttons_changed);
+    into->buttons_changed = into->buttons_changed | sample->buttons_changed;
+}
+
+static bool sampler_enqueue(const pointing_device_sample_t *sample) {
+    uint8_t head = sampler_head;
+    uint8_t next = (head + 1) & SAMPLER_INDEX_MASK;
+    if (next == __atomic_load_n(&sampler_tail, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    sampler_buffer[head] = *sample;
+    __atomic_store_n(&sampler_head, next, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Queues a sample for the next report
+ *
+ * Must only be called from a single context, e.g. the sensor's motion interrupt, a timer or a thread. When the buffer
+ * is full the sample is merged with the other samples held back, and queued once there is room, so no motion is lost.
+ * Samples without motion or button changes are not queued, but still move held back samples into the buffer.
+ *
+ * @param[in] sample pointing_device_sample_t to queue
+ * @return true if the sample was queued, false if it was held back
+ */
+bool pointing_device_sampler_push(const pointing_device_sample_t *sample) {
+    bool empty = !(sample->x || sample->y || sample->h || sample->v || sample->buttons_changed);
+
+    // Samples held back go first, so that the buffer stays in order
+    if (sampler_has_pending) {
+        if (!sampler_enqueue(&sampler_pending)) {
+            if (!empty) {
+                sampler_merge(&sampler_pending, sample);
+                sampler_stats.overruns++;
+            }
+            return false;
+        }
+        sampler_has_pending = false;
+    }
+
+    if (empty) {
+        return true;
+    }
+    if (!sampler_enqueue(sample)) {
+        sampler_pending     = *sample;
+        sampler_has_pending = true;
+        sampler_stats.overruns++;
+        return false;
+    }
+    return true;
+}
+
+static mouse_xy_report_t sampler_take_xy(int32_t *motion) {
+    mouse_xy_report_t value = CONSTRAIN_HID_XY(*motion);
+    *motion -= value;
+    return value;
+}
+
+static mouse_hv_report_t sampler_take_hv(int32_t *motion) {
+    mouse_hv_report_t value = *motion < MOUSE_REPORT_HV_MIN ? MOUSE_REPORT_HV_MIN : (*motion > MOUSE_REPORT_HV_MAX ? MOUSE_REPORT_HV_MAX : *motion);
+    *motion -= value;
+    return value;
+}
+
+/**
+ * @brief Merges every queued sample into a mouse report
+ *
+ * Motion which does not fit in a single report is carried over to the next one. Buttons the driver did not change
+ * keep their state in mouse_report, and samples releasing a button pressed earlier in the same batch (or vice versa)
+ * are left for the next report.
+ *
+ * @param[in] mouse_report report_mouse_t to merge the samples into
+ * @return report_mouse_t with the motion of all samples since the last call
+ */
+report_mouse_t pointing_device_sampler_consume(report_mouse_t mouse_report) {
+    uint8_t  tail        = sampler_tail;
+    uint8_t  head        = __atomic_load_n(&sampler_head, __ATOMIC_ACQUIRE);
+    uint8_t  samples     = 0;
+    uint8_t  changed     = 0;
+    uint16_t newest_time = 0;
+
+    while (tail != head) {
+        const pointing_device_sample_t *sample = &sampler_buffer[tail];
+
+        // A button changing twice, e.g. a quick click, is left for the next report so that the host sees both edges
+        if (sample->buttons_changed & changed) {
+            break;
+        }
+        changed |= sample->buttons_changed;
+
+        residual_x += sample->x;
+        residual_y += sample->y;
+        residual_h += sample->h;
+        residual_v += sample->v;
+        mouse_report.buttons = (mouse_report.buttons & ~sample->buttons_changed) | (sample->buttons & sample->buttons_changed);
+        newest_time          = sample->time;
+
+        tail = (tail + 1) & SAMPLER_INDEX_MASK;
+        samples++;
+    }
+    __atomic_store_n(&sampler_tail, tail, __ATOMIC_RELEASE);
+
+    sampler_stats.samples = samples;
+    if (samples) {
+        sampler_stats.interval = has_last_sample ? newest_time - last_sample_time : 0;
+        last_sample_time       = newest_time;
+        has_last_sample        = true;
+    }
+
+    mouse_report.x = sampler_take_xy(&residual_x);
+    mouse_report.y = sampler_take_xy(&residual_y);
+    mouse_report.h = sampler_take_hv(&residual_h);
+    mouse_report.v = sampler_take_hv(&residual_v);
+    return mouse_report;
+}
+
+/**
+ * @brief Gets statistics of the last report built from the samples
+ *
+ * @param[out] stats pointing_device_sampler_stats_t to fill
+ */
+void pointing_device_sampler_get_stats(pointing_device_sampler_stats_t *stats) {
+    *stats = sampler_stats;
+}
+
+#    ifdef POINTING_DEVICE_SAMPLER_THREAD
+static MUTEX_DECL(sampler_driver_mutex);
+
+/**
+ * @brief Acquires exclusive access to the pointing device driver
+ *
+ * The sampling thread holds it while reading the sensor. Any other call into the driver, e.g. to change its CPI, must
+ * hold it too, as the bus drivers do not serialise transactions between threads.
+ */
+void pointing_device_lock(void) {
+    chMtxLock(&sampler_driver_mutex);
+}
+
+/**
+ * @brief Releases the pointing device driver acquired by pointing_device_lock()
+ */
+void pointing_device_unlock(void) {
+    chMtxUnlock(&sampler_driver_mutex);
+}
+
+static THD_WORKING_AREA(waSamplerThread, POINTING_DEVICE_SAMPLER_THREAD_STACK);
+static THD_FUNCTION(SamplerThread, arg) {
+    (void)arg;
+    chRegSetThreadName("pointing");
+
+    systime_t next = chVTGetSystemTimeX();
+    while (true) {
+        pointing_device_sample();
+        next = chThdSleepUntilWindowed(next, chTimeAddX(next, TIME_MS2I(POINTING_DEVICE_SAMPLER_INTERVAL_MS)));
+    }
+}
+#    endif
+
+/**
+ * @brief Starts sampling the pointing device outside of the main loop, if configured
+ */
+void pointing_device_sampler_init(void) {
+#    ifdef POINTING_DEVICE_SAMPLER_THREAD
+    chThdCreateStatic(waSamplerThread, sizeof(waSamplerThread), HIGHPRIO, SamplerThread, NULL);
+#    endif
+}
+
+#endif // POINTING_DEVICE_SAMPLER_ENABLE
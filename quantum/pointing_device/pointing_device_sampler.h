@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+#ifndef POINTING_DEVICE_SAMPLER_ENABLE
+#    error "POINTING_DEVICE_SAMPLER_ENABLE not defined! check config settings"
+#endif
+
+// Number of samples buffered between the sampling context and pointing_device_task(), must be a power of two
+#ifndef POINTING_DEVICE_SAMPLER_BUFFER_SIZE
+#    define POINTING_DEVICE_SAMPLER_BUFFER_SIZE 16
+#endif
+
+#if (POINTING_DEVICE_SAMPLER_BUFFER_SIZE & (POINTING_DEVICE_SAMPLER_BUFFER_SIZE - 1)) != 0 || POINTING_DEVICE_SAMPLER_BUFFER_SIZE > 128
+#    error "POINTING_DEVICE_SAMPLER_BUFFER_SIZE must be a power of two, no larger than 128"
+#endif
+
+#ifdef POINTING_DEVICE_SAMPLER_THREAD
+// Milliseconds between reads of the sensor by the sampling thread
+#    ifndef POINTING_DEVICE_SAMPLER_INTERVAL_MS
+#        define POINTING_DEVICE_SAMPLER_INTERVAL_MS 1
+#    endif
+#endif
+
+typedef struct {
+    uint16_t time;            // timer_read() when the sensor was read
+    int16_t  x;               // motion since the previous sample
+    int16_t  y;
+    int16_t  h;
+    int16_t  v;
+    uint8_t  buttons;         // state of the buttons reported by the driver
+    uint8_t  buttons_changed; // buttons the driver changed since the previous sample
+} pointing_device_sample_t;
+
+typedef struct {
+    uint8_t  samples;  // samples merged into the last report
+    uint16_t interval; // milliseconds between the newest sample of the last report and that of the one before
+    uint16_t overruns; // times the buffer was full and samples had to be merged before queueing, since boot
+} pointing_device_sampler_stats_t;
+
+void           pointing_device_sampler_init(void);
+bool           pointing_device_sampler_push(const pointing_device_sample_t *sample);
+void           pointing_device_sample(void);
+report_mouse_t pointing_device_sampler_consume(report_mouse_t mouse_report);
+void           pointing_device_sampler_get_stats(pointing_device_sampler_stats_t *stats);
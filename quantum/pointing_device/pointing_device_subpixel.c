@@ -0,0 +1,142 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device.h"
+
+#ifdef POINTING_DEVICE_SUBPIXEL_ENABLE
+
+// Motion not reported yet: fractions, and whatever did not fit in the last report
+static pointing_device_motion_t residual = {0};
+
+static inline pd_fixed_t subpixel_saturate(int64_t value) {
+    return value < INT32_MIN ? INT32_MIN : (value > INT32_MAX ? INT32_MAX : value);
+}
+
+static inline pd_fixed_t subpixel_add(pd_fixed_t a, pd_fixed_t b) {
+    return subpixel_saturate((int64_t)a + b);
+}
+
+// Takes the whole counts, rounded towards zero so that the residual never changes sign, and within [min, max].
+// What is left is limited to one more report, so a flick does not keep sending full reports long after it ended.
+static int32_t subpixel_take(pd_fixed_t *motion, int32_t min, int32_t max) {
+    int32_t whole = *motion / PD_FIXED_ONE;
+    if (whole < min) {
+        whole = min;
+    } else if (whole > max) {
+        whole = max;
+    }
+    *motion -= whole * PD_FIXED_ONE;
+    if (*motion < PD_FIXED_FROM_INT(min)) {
+        *motion = PD_FIXED_FROM_INT(min);
+    } else if (*motion > PD_FIXED_FROM_INT(max)) {
+        *motion = PD_FIXED_FROM_INT(max);
+    }
+    return whole;
+}
+
+/**
+ * @brief Weak function allowing for keyboard level processing of fractional motion
+ *
+ * Takes the motion of the current report in Q16.16 fixed point, after rotation and inversion, then returns
+ * pointing_device_motion_user(motion) by default. Fractions of the returned motion are carried over to later reports.
+ *
+ * @param[in] motion pointing_device_motion_t
+ * @return pointing_device_motion_t
+ */
+__attribute__((weak)) pointing_device_motion_t pointing_device_motion_kb(pointing_device_motion_t motion) {
+    return pointing_device_motion_user(motion);
+}
+
+/**
+ * @brief Weak function allowing for user level processing of fractional motion
+ *
+ * @param[in] motion pointing_device_motion_t
+ * @return pointing_device_motion_t
+ */
+__attribute__((weak)) pointing_device_motion_t pointing_device_motion_user(pointing_device_motion_t motion) {
+    return motion;
+}
+
+/**
+ * @brief Converts the motion of a mouse report to fixed point
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return pointing_device_motion_t
+ */
+pointing_device_motion_t pointing_device_motion_from_report(report_mouse_t mouse_report) {
+    return (pointing_device_motion_t){
+        .x = PD_FIXED_FROM_INT(mouse_report.x),
+        .y = PD_FIXED_FROM_INT(mouse_report.y),
+        .h = PD_FIXED_FROM_INT(mouse_report.h),
+        .v = PD_FIXED_FROM_INT(mouse_report.v),
+    };
+}
+
+/**
+ * @brief Queues fractional motion for the next report
+ *
+ * Allows drivers and keyboard code to add motion which is not a whole number of counts, e.g. from a scaled sensor.
+ *
+ * @param[in] motion pointing_device_motion_t to add
+ */
+void pointing_device_subpixel_add(pointing_device_motion_t motion) {
+    residual.x = subpixel_add(residual.x, motion.x);
+    residual.y = subpixel_add(residual.y, motion.y);
+    residual.h = subpixel_add(residual.h, motion.h);
+    residual.v = subpixel_add(residual.v, motion.v);
+}
+
+/**
+ * @brief Drops any motion not reported yet, e.g. when switching between moving the cursor and scrolling
+ */
+void pointing_device_subpixel_clear(void) {
+    residual = (pointing_device_motion_t){0};
+}
+
+/**
+ * @brief Converts scrolling from wheel notches to the units of the mouse report
+ *
+ * With POINTING_DEVICE_HIRES_SCROLL_ENABLE each notch is split into pointing_device_get_hires_scroll_resolution()
+ * units, otherwise a unit is a notch.
+ *
+ * @param[in] notches pd_fixed_t
+ * @return pd_fixed_t in mouse report units
+ */
+pd_fixed_t pointing_device_scroll_from_notches(pd_fixed_t notches) {
+#    ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+    return subpixel_saturate((int64_t)notches * pointing_device_get_hires_scroll_resolution());
+#    else
+    return notches;
+#    endif
+}
+
+/**
+ * @brief Runs the motion of a mouse report through the fixed point pipeline
+ *
+ * Motion is accelerated if POINTING_DEVICE_ACCEL_ENABLE is defined, passed to pointing_device_motion_kb(), given
+ * glide if POINTING_DEVICE_KINETIC_ENABLE is defined and added to whatever was carried over, then the whole counts
+ * which fit are reported. The rest, up to one more full report, is kept for later reports, so no motion is lost to
+ * truncation.
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with the whole counts of the accumulated motion
+ */
+report_mouse_t pointing_device_subpixel_task(report_mouse_t mouse_report) {
+    pointing_device_motion_t motion = pointing_device_motion_from_report(mouse_report);
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    motion = pointing_device_accel_apply(motion);
+#    endif
+    motion = pointing_device_motion_kb(motion);
+#    ifdef POINTING_DEVICE_KINETIC_ENABLE
+    motion = pointing_device_kinetic_task(motion, mouse_report.buttons);
+#    endif
+    pointing_device_subpixel_add(motion);
+
+    mouse_report.x = subpixel_take(&residual.x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.y = subpixel_take(&residual.y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.h = subpixel_take(&residual.h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.v = subpixel_take(&residual.v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    return mouse_report;
+}
+
+#endif // POINTING_DEVICE_SUBPIXEL_ENABLE
@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "report.h"
+
+#ifndef POINTING_DEVICE_SUBPIXEL_ENABLE
+#    error "POINTING_DEVICE_SUBPIXEL_ENABLE not defined! check config settings"
+#endif
+
+// Q16.16 fixed point: 16 integer bits and 16 fractional bits
+typedef int32_t pd_fixed_t;
+
+#define PD_FIXED_SHIFT 16
+#define PD_FIXED_ONE ((pd_fixed_t)1 << PD_FIXED_SHIFT)
+
+// Converts a constant at compile time, e.g. PD_FIXED(0.25)
+#define PD_FIXED(value) ((pd_fixed_t)((value) * PD_FIXED_ONE))
+#define PD_FIXED_FROM_INT(value) ((pd_fixed_t)(value) * PD_FIXED_ONE)
+#define PD_FIXED_RATIO(numerator, denominator) ((pd_fixed_t)(((int64_t)(numerator) * PD_FIXED_ONE) / (denominator)))
+
+static inline pd_fixed_t pd_fixed_mul(pd_fixed_t a, pd_fixed_t b) {
+    return (pd_fixed_t)(((int64_t)a * b) / PD_FIXED_ONE);
+}
+
+static inline pd_fixed_t pd_fixed_div(pd_fixed_t a, pd_fixed_t b) {
+    return b ? (pd_fixed_t)(((int64_t)a * PD_FIXED_ONE) / b) : 0;
+}
+
+typedef struct {
+    pd_fixed_t x;
+    pd_fixed_t y;
+    pd_fixed_t h;
+    pd_fixed_t v;
+} pointing_device_motion_t;
+
+pointing_device_motion_t pointing_device_motion_from_report(report_mouse_t mouse_report);
+report_mouse_t           pointing_device_subpixel_task(report_mouse_t mouse_report);
+void                     pointing_device_subpixel_add(pointing_device_motion_t motion);
+void                     pointing_device_subpixel_clear(void);
+pd_fixed_t               pointing_device_scroll_from_notches(pd_fixed_t notches);
+
+pointing_device_motion_t pointing_device_motion_kb(pointing_device_motion_t motion);
+pointing_device_motion_t pointing_device_motion_user(pointing_device_motion_t motion);
@@ -0,0 +1,268 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device.h"
+
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+
+#    include "timer.h"
+#    include "util.h"
+#    ifdef DIGITIZER_TOUCHPAD
+#        include "digitizer.h"
+#    endif
+
+typedef enum {
+    TOUCH_IDLE,      // nothing on the sensor
+    TOUCH_DECIDING,  // several fingers down, not moved far enough to tell what they do
+    TOUCH_POINTING,  // one finger moves the cursor
+    TOUCH_SCROLLING, // two fingers move together
+    TOUCH_PINCHING,  // two fingers move apart or together
+    TOUCH_SWIPING,   // three or more fingers, until they have moved far enough
+    TOUCH_DONE,      // gesture recognised, waiting for every finger to lift
+} touch_state_t;
+
+// Everything the recogniser keeps between frames, the contacts themselves are only looked at once
+static struct {
+    touch_state_t state;
+    bool          tap_possible;
+    uint8_t       max_count;
+    uint8_t       buttons; // pressed by a tap, released with the next frame
+    uint16_t      start_time;
+    uint32_t      ids; // one bit per contact id, to notice fingers being added or lifted
+    int32_t       x;   // centroid of the previous frame
+    int32_t       y;
+    int32_t       spread; // mean distance of the contacts from the centroid in the previous frame
+    int32_t       moved_x;
+    int32_t       moved_y;
+    int32_t       pinched;
+    int32_t       scroll_x;
+    int32_t       scroll_y;
+} touch;
+
+#    ifdef DIGITIZER_TOUCHPAD
+static bool touch_digitizer = true;
+#    endif
+
+/**
+ * @brief Weak function allowing for keyboard level handling of touch gestures
+ *
+ * Returns pointing_device_touch_gesture_user(gesture) by default.
+ *
+ * @param[in] gesture pointing_device_gesture_t
+ * @return true to continue with the default action, which clicks the matching button for taps
+ */
+__attribute__((weak)) bool pointing_device_touch_gesture_kb(pointing_device_gesture_t gesture) {
+    return pointing_device_touch_gesture_user(gesture);
+}
+
+/**
+ * @brief Weak function allowing for user level handling of touch gestures
+ *
+ * @param[in] gesture pointing_device_gesture_t
+ * @return true to continue with the default action
+ */
+__attribute__((weak)) bool pointing_device_touch_gesture_user(pointing_device_gesture_t gesture) {
+    return true;
+}
+
+/**
+ * @brief Forgets the current touch, e.g. when the sensor is reset
+ */
+void pointing_device_touch_reset(void) {
+    touch = (typeof(touch)){0};
+}
+
+#    ifdef DIGITIZER_TOUCHPAD
+/**
+ * @brief Sends the contacts to the host as a touchpad instead of recognising gestures
+ *
+ * Hosts with multi-touch support then handle acceleration and gestures themselves. When disabled, contacts still on
+ * the touchpad are lifted and gestures move the cursor again.
+ *
+ * @param[in] enable bool
+ */
+void pointing_device_touch_set_digitizer(bool enable) {
+    digitizer_touchpad_set_contacts(NULL, 0);
+    pointing_device_touch_reset();
+    touch_digitizer = enable;
+}
+
+bool pointing_device_touch_get_digitizer(void) {
+    return touch_digitizer;
+}
+
+// Only scales the contacts to the range of the digitizer report, the host recognises gestures
+static void touch_send_digitizer(const pointing_device_touch_frame_t *frame, uint8_t count) {
+    digitizer_contact_t contacts[POINTING_DEVICE_TOUCH_MAX_CONTACTS];
+
+    for (uint8_t i = 0; i < count; i++) {
+        const pointing_device_touch_contact_t *contact = &frame->contacts[i];
+        contacts[i]                                    = (digitizer_contact_t){
+            .id = contact->id,
+            .x  = frame->width ? MIN((uint32_t)contact->x * 0x7FFF / frame->width, 0x7FFF) : contact->x,
+            .y  = frame->height ? MIN((uint32_t)contact->y * 0x7FFF / frame->height, 0x7FFF) : contact->y,
+        };
+    }
+    digitizer_touchpad_set_contacts(contacts, count);
+}
+#    endif
+
+static inline int32_t touch_abs(int32_t value) {
+    return value < 0 ? -value : value;
+}
+
+// Distance approximated as max + 3/8 min, within 7% of the real one without a square root
+static inline int32_t touch_distance(int32_t dx, int32_t dy) {
+    dx = touch_abs(dx);
+    dy = touch_abs(dy);
+    return dx > dy ? dx + ((dy >> 3) * 3) : dy + ((dx >> 3) * 3);
+}
+
+static report_mouse_t touch_tap(report_mouse_t mouse_report) {
+    static const pointing_device_gesture_t gestures[] = {POINTING_DEVICE_GESTURE_TAP, POINTING_DEVICE_GESTURE_TWO_FINGER_TAP, POINTING_DEVICE_GESTURE_THREE_FINGER_TAP};
+    static const pointing_device_buttons_t buttons[]  = {POINTING_DEVICE_BUTTON1, POINTING_DEVICE_BUTTON2, POINTING_DEVICE_BUTTON3};
+    uint8_t                                index      = MIN(touch.max_count, ARRAY_SIZE(gestures)) - 1;
+
+    if (pointing_device_touch_gesture_kb(gestures[index])) {
+        touch.buttons        = pointing_device_handle_buttons(touch.buttons, true, buttons[index]);
+        mouse_report.buttons = pointing_device_handle_buttons(mouse_report.buttons, true, buttons[index]);
+    }
+    return mouse_report;
+}
+
+static void touch_swipe(void) {
+    if (touch_abs(touch.moved_x) >= touch_abs(touch.moved_y)) {
+        pointing_device_touch_gesture_kb(touch.moved_x < 0 ? POINTING_DEVICE_GESTURE_SWIPE_LEFT : POINTING_DEVICE_GESTURE_SWIPE_RIGHT);
+    } else {
+        pointing_device_touch_gesture_kb(touch.moved_y < 0 ? POINTING_DEVICE_GESTURE_SWIPE_UP : POINTING_DEVICE_GESTURE_SWIPE_DOWN);
+    }
+}
+
+/**
+ * @brief Recognises gestures from a frame of touch contacts
+ *
+ * Drivers call this with every read of a touch sensor, including frames without contacts. One finger moves the
+ * cursor, two fingers scroll or pinch, three or more swipe, and a short touch which does not move taps. Only a fixed
+ * amount of state is kept, so each frame takes time proportional to its number of contacts. While the digitizer is
+ * enabled with DIGITIZER_TOUCHPAD, the contacts go to the host instead and the report is returned unchanged.
+ *
+ * @param[in] frame pointing_device_touch_frame_t with the contacts currently on the sensor
+ * @param[in] mouse_report report_mouse_t to add motion, scrolling and buttons to
+ * @return report_mouse_t
+ */
+report_mouse_t pointing_device_touch_process(const pointing_device_touch_frame_t *frame, report_mouse_t mouse_report) {
+    uint8_t count = MIN(frame->count, POINTING_DEVICE_TOUCH_MAX_CONTACTS);
+
+    // Taps click for a single frame
+    mouse_report.buttons &= ~touch.buttons;
+    touch.buttons = 0;
+
+#    ifdef DIGITIZER_TOUCHPAD
+    if (touch_digitizer) {
+        touch_send_digitizer(frame, count);
+        return mouse_report;
+    }
+#    endif
+
+    if (!count) {
+        if (touch.state != TOUCH_IDLE && touch.tap_possible && TIMER_DIFF_16(frame->time, touch.start_time) <= POINTING_DEVICE_TOUCH_TAP_TERM) {
+            mouse_report = touch_tap(mouse_report);
+        }
+        touch.state = TOUCH_IDLE;
+        return mouse_report;
+    }
+
+    int32_t  x = 0, y = 0, spread = 0;
+    uint32_t ids = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        x += frame->contacts[i].x;
+        y += frame->contacts[i].y;
+        ids |= 1UL << (frame->contacts[i].id & 31);
+    }
+    x /= count;
+    y /= count;
+    for (uint8_t i = 0; i < count; i++) {
+        spread += touch_distance(frame->contacts[i].x - x, frame->contacts[i].y - y);
+    }
+    spread /= count;
+
+    if (touch.state == TOUCH_IDLE) {
+        touch.tap_possible = true;
+        touch.max_count    = 0;
+        touch.start_time   = frame->time;
+    }
+    if (touch.state == TOUCH_IDLE || ids != touch.ids) {
+        // Fingers were added or lifted, start over from where they are so that the centroid does not jump
+        if (touch.state != TOUCH_DONE) {
+            touch.state = count == 1 ? TOUCH_POINTING : TOUCH_DECIDING;
+        }
+        touch.max_count = MAX(touch.max_count, count);
+        touch.ids       = ids;
+        touch.x         = x;
+        touch.y         = y;
+        touch.spread    = spread;
+        touch.moved_x   = 0;
+        touch.moved_y   = 0;
+        touch.pinched   = 0;
+        touch.scroll_x  = 0;
+        touch.scroll_y  = 0;
+        return mouse_report;
+    }
+
+    int32_t dx = x - touch.x;
+    int32_t dy = y - touch.y;
+    touch.moved_x += dx;
+    touch.moved_y += dy;
+    touch.pinched += spread - touch.spread;
+    touch.x      = x;
+    touch.y      = y;
+    touch.spread = spread;
+
+    if (touch_distance(touch.moved_x, touch.moved_y) > POINTING_DEVICE_TOUCH_TAP_DISTANCE || touch_abs(touch.pinched) > POINTING_DEVICE_TOUCH_TAP_DISTANCE || TIMER_DIFF_16(frame->time, touch.start_time) > POINTING_DEVICE_TOUCH_TAP_TERM) {
+        touch.tap_possible = false;
+    }
+
+    if (touch.state == TOUCH_DECIDING) {
+        if (count > 2) {
+            touch.state = TOUCH_SWIPING;
+        } else if (touch_abs(touch.pinched) > POINTING_DEVICE_TOUCH_TAP_DISTANCE) {
+            touch.state = TOUCH_PINCHING;
+        } else if (touch_distance(touch.moved_x, touch.moved_y) > POINTING_DEVICE_TOUCH_TAP_DISTANCE) {
+            touch.state = TOUCH_SCROLLING;
+        }
+    }
+
+    switch (touch.state) {
+        case TOUCH_POINTING:
+            mouse_report.x = CONSTRAIN_HID_XY(mouse_report.x + dx);
+            mouse_report.y = CONSTRAIN_HID_XY(mouse_report.y + dy);
+            break;
+        case TOUCH_SCROLLING:
+            // Same directions as the scroll gesture of the IQS5xx, what is left over is kept for the next frame
+            touch.scroll_x += dx;
+            touch.scroll_y += dy;
+            mouse_report.h = CONSTRAIN_HID(touch.scroll_x / POINTING_DEVICE_TOUCH_SCROLL_DIVISOR);
+            mouse_report.v = CONSTRAIN_HID(touch.scroll_y / POINTING_DEVICE_TOUCH_SCROLL_DIVISOR);
+            touch.scroll_x -= mouse_report.h * POINTING_DEVICE_TOUCH_SCROLL_DIVISOR;
+            touch.scroll_y -= mouse_report.v * POINTING_DEVICE_TOUCH_SCROLL_DIVISOR;
+            break;
+        case TOUCH_PINCHING:
+            while (touch_abs(touch.pinched) >= POINTING_DEVICE_TOUCH_PINCH_DISTANCE) {
+                bool out = touch.pinched > 0;
+                pointing_device_touch_gesture_kb(out ? POINTING_DEVICE_GESTURE_PINCH_OUT : POINTING_DEVICE_GESTURE_PINCH_IN);
+                touch.pinched -= out ? POINTING_DEVICE_TOUCH_PINCH_DISTANCE : -POINTING_DEVICE_TOUCH_PINCH_DISTANCE;
+            }
+            break;
+        case TOUCH_SWIPING:
+            if (touch_distance(touch.moved_x, touch.moved_y) >= POINTING_DEVICE_TOUCH_SWIPE_DISTANCE) {
+                touch_swipe();
+                touch.state = TOUCH_DONE;
+            }
+            break;
+        default:
+            break;
+    }
+    return mouse_report;
+}
+
+#endif // POINTING_DEVICE_TOUCH_ENABLE
@@ -0,0 +1,84 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+#ifndef POINTING_DEVICE_TOUCH_ENABLE
+#    error "POINTING_DEVICE_TOUCH_ENABLE not defined! check config settings"
+#endif
+
+#if defined(DIGITIZER_TOUCHPAD) && !defined(DIGITIZER_ENABLE)
+#    error "DIGITIZER_TOUCHPAD requires DIGITIZER_ENABLE = yes"
+#endif
+
+// Most contacts tracked in a frame, further contacts are ignored
+#ifndef POINTING_DEVICE_TOUCH_MAX_CONTACTS
+#    define POINTING_DEVICE_TOUCH_MAX_CONTACTS 5
+#endif
+
+// Longest time in milliseconds a touch can last to be a tap
+#ifndef POINTING_DEVICE_TOUCH_TAP_TERM
+#    define POINTING_DEVICE_TOUCH_TAP_TERM 150
+#endif
+
+// Furthest distance in sensor units fingers can move during a tap
+#ifndef POINTING_DEVICE_TOUCH_TAP_DISTANCE
+#    define POINTING_DEVICE_TOUCH_TAP_DISTANCE 50
+#endif
+
+// Distance in sensor units two fingers move for each unit of scrolling
+#ifndef POINTING_DEVICE_TOUCH_SCROLL_DIVISOR
+#    define POINTING_DEVICE_TOUCH_SCROLL_DIVISOR 40
+#endif
+
+// Change in sensor units of the distance between two fingers for each pinch step
+#ifndef POINTING_DEVICE_TOUCH_PINCH_DISTANCE
+#    define POINTING_DEVICE_TOUCH_PINCH_DISTANCE 100
+#endif
+
+// Distance in sensor units three or more fingers move to swipe
+#ifndef POINTING_DEVICE_TOUCH_SWIPE_DISTANCE
+#    define POINTING_DEVICE_TOUCH_SWIPE_DISTANCE 300
+#endif
+
+typedef struct {
+    uint8_t  id;       // stays the same while the finger is down
+    uint16_t x;        // absolute position, in sensor units
+    uint16_t y;        // absolute position, in sensor units
+    uint8_t  pressure; // 0 if unknown
+} pointing_device_touch_contact_t;
+
+typedef struct {
+    uint16_t                        time;   // timer_read() when the contacts were read
+    uint16_t                        width;  // range of the x coordinates, 0 if unknown
+    uint16_t                        height; // range of the y coordinates, 0 if unknown
+    uint8_t                         count;
+    pointing_device_touch_contact_t contacts[POINTING_DEVICE_TOUCH_MAX_CONTACTS];
+} pointing_device_touch_frame_t;
+
+typedef enum {
+    POINTING_DEVICE_GESTURE_TAP,
+    POINTING_DEVICE_GESTURE_TWO_FINGER_TAP,
+    POINTING_DEVICE_GESTURE_THREE_FINGER_TAP,
+    POINTING_DEVICE_GESTURE_PINCH_IN,
+    POINTING_DEVICE_GESTURE_PINCH_OUT,
+    POINTING_DEVICE_GESTURE_SWIPE_LEFT,
+    POINTING_DEVICE_GESTURE_SWIPE_RIGHT,
+    POINTING_DEVICE_GESTURE_SWIPE_UP,
+    POINTING_DEVICE_GESTURE_SWIPE_DOWN,
+} pointing_device_gesture_t;
+
+report_mouse_t pointing_device_touch_process(const pointing_device_touch_frame_t *frame, report_mouse_t mouse_report);
+void           pointing_device_touch_reset(void);
+
+bool pointing_device_touch_gesture_kb(pointing_device_gesture_t gesture);
+bool pointing_device_touch_gesture_user(pointing_device_gesture_t gesture);
+
+#ifdef DIGITIZER_TOUCHPAD
+void pointing_device_touch_set_digitizer(bool enable);
+bool pointing_device_touch_get_digitizer(void);
+#endif
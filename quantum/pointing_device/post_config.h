@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Acceleration works on fractional motion
+#if defined(POINTING_DEVICE_ACCEL_ENABLE) && !defined(POINTING_DEVICE_SUBPIXEL_ENABLE)
+#    define POINTING_DEVICE_SUBPIXEL_ENABLE
+#endif
+
+// Gliding adds fractional motion
+#if defined(POINTING_DEVICE_KINETIC_ENABLE) && !defined(POINTING_DEVICE_SUBPIXEL_ENABLE)
+#    define POINTING_DEVICE_SUBPIXEL_ENABLE
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+// Collects the HSV output of an effect runner, so it can be converted to RGB in batches
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_ROW_SIZE];
+    hsv_t   hsv[RGB_MATRIX_HSV_ROW_SIZE];
+} hsv_row_t;
+
+static void hsv_row_flush(hsv_row_t* row) {
+    rgb_t rgb[RGB_MATRIX_HSV_ROW_SIZE];
+    rgb_matrix_hsv_to_rgb_batch(row->hsv, rgb, row->count);
+    for (uint8_t j = 0; j < row->count; j++) {
+        rgb_matrix_set_color(row->index[j], rgb[j].r, rgb[j].g, rgb[j].b);
+    }
+    row->count = 0;
+}
+
+static inline void hsv_row_push(hsv_row_t* row, uint8_t i, hsv_t hsv) {
+    row->index[row->count] = i;
+    row->hsv[row->count]   = hsv;
+    if (++row->count == RGB_MATRIX_HSV_ROW_SIZE) {
+        hsv_row_flush(row);
+    }
+}
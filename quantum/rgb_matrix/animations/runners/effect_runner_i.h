@@ -5,11 +5,12 @@ typedef hsv_t (*i_f)(hsv_t hsv, uint8_t i, uint8_t time);
 bool effect_runner_i(effect_params_t* params, i_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
-    uint8_t time = scale16by8(g_rgb_timer, qadd8(rgb_matrix_config.speed / 4, 1));
+    uint8_t   time = scale16by8(g_rgb_timer, qadd8(rgb_matrix_config.speed / 4, 1));
+    hsv_row_t row  = {.count = 0};
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
-        rgb_t rgb = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, i, time));
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+        hsv_row_push(&row, i, effect_func(rgb_matrix_config.hsv, i, time));
     }
+    hsv_row_flush(&row);
     return rgb_matrix_check_finished_leds(led_max);
 }
@@ -0,0 +1,16 @@
+#pragma once
+
+typedef hsv_t (*polar_f)(hsv_t hsv, uint8_t dist, uint8_t angle, uint8_t time);
+
+bool effect_runner_polar(effect_params_t* params, polar_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t   time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    hsv_row_t row  = {.count = 0};
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        hsv_row_push(&row, i, effect_func(rgb_matrix_config.hsv, rgb_matrix_led_dist(i), rgb_matrix_led_angle(i), time));
+    }
+    hsv_row_flush(&row);
+    return rgb_matrix_check_finished_leds(led_max);
+}
@@ -7,7 +7,8 @@ typedef hsv_t (*reactive_f)(hsv_t hsv, uint16_t offset);
 bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
-    uint16_t max_tick = 65535 / qadd8(rgb_matrix_config.speed, 1);
+    uint16_t  max_tick = 65535 / qadd8(rgb_matrix_config.speed, 1);
+    hsv_row_t row      = {.count = 0};
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         uint16_t tick = max_tick;
@@ -20,9 +21,9 @@ bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
         }
 
         uint16_t offset = scale16by8(tick, qadd8(rgb_matrix_config.speed, 1));
-        rgb_t    rgb    = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, offset));
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+        hsv_row_push(&row, i, effect_func(rgb_matrix_config.hsv, offset));
     }
+    hsv_row_flush(&row);
     return rgb_matrix_check_finished_leds(led_max);
 }
 
@@ -2,28 +2,54 @@
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#    include "rgb_matrix_spatial.h"
+
 typedef hsv_t (*reactive_splash_f)(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
 
-bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
+// Returns the distance beyond which a hit of the supplied age no longer lights an LED. Hits out of range are still
+// passed to the effect, with a dist of UINT8_MAX, so any hue changes they make are kept.
+typedef uint8_t (*reactive_splash_range_f)(uint16_t tick);
+
+bool effect_runner_reactive_splash_ranged(uint8_t start, effect_params_t* params, reactive_splash_f effect_func, reactive_splash_range_f range_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
-    uint8_t count = g_last_hit_tracker.count;
+    uint8_t   count = g_last_hit_tracker.count;
+    hsv_row_t row   = {.count = 0};
+
+    // Bucket the hits into the grid cells they can reach, so each LED only evaluates nearby hits
+    rgb_matrix_hit_mask_t cell_hits[RGB_MATRIX_SPATIAL_CELL_COUNT] = {0};
+    for (uint8_t j = start; j < count; j++) {
+        if (range_func) {
+            uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+            rgb_matrix_spatial_mark_hit(cell_hits, j, g_last_hit_tracker.x[j], g_last_hit_tracker.y[j], range_func(tick));
+        } else {
+            rgb_matrix_spatial_mark_hit(cell_hits, j, 0, 0, UINT8_MAX);
+        }
+    }
+
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         hsv_t hsv = rgb_matrix_config.hsv;
         hsv.v     = 0;
-        for (uint8_t j = start; j < count; j++) {
+
+        // An LED no hit can reach stays dark, whatever its hue, so there's nothing to evaluate
+        rgb_matrix_hit_mask_t hits = cell_hits[rgb_matrix_spatial_cell(g_led_config.point[i])];
+        for (uint8_t j = start; hits && j < count; j++) {
             int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
             int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
+            uint8_t  dist = (hits & ((rgb_matrix_hit_mask_t)1 << j)) ? sqrt16(dx * dx + dy * dy) : UINT8_MAX;
             uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
             hsv           = effect_func(hsv, dx, dy, dist, tick);
         }
-        hsv.v     = scale8(hsv.v, rgb_matrix_config.hsv.v);
-        rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+        hsv.v = scale8(hsv.v, rgb_matrix_config.hsv.v);
+        hsv_row_push(&row, i, hsv);
     }
+    hsv_row_flush(&row);
     return rgb_matrix_check_finished_leds(led_max);
 }
 
+bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
+    return effect_runner_reactive_splash_ranged(start, params, effect_func, NULL);
+}
+
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
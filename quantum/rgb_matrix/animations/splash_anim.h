@@ -19,15 +19,20 @@ hsv_t SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick
     return hsv;
 }
 
+static uint8_t SPLASH_range(uint16_t tick) {
+    // The splash ring has travelled `tick` units from the hit
+    return MIN(tick, UINT8_MAX);
+}
+
 #            ifdef ENABLE_RGB_MATRIX_SPLASH
 bool SPLASH(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SPLASH_math);
+    return effect_runner_reactive_splash_ranged(qsub8(g_last_hit_tracker.count, 1), params, &SPLASH_math, &SPLASH_range);
 }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_MULTISPLASH
 bool MULTISPLASH(effect_params_t* params) {
-    return effect_runner_reactive_splash(0, params, &SPLASH_math);
+    return effect_runner_reactive_splash_ranged(0, params, &SPLASH_math, &SPLASH_range);
 }
 #            endif
 
@@ -32,8 +32,14 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
             if (i_row == row && i_col == col) {
                 g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
+                led_point_t point_a = g_led_config.point[g_led_config.matrix_co[row][col]];
+                led_point_t point_b = g_led_config.point[g_led_config.matrix_co[i_row][i_col]];
+                // Cheap bounding box rejection, as most of the matrix is well outside the spread
+                if (abs(point_a.x - point_b.x) > RGB_MATRIX_TYPING_HEATMAP_SPREAD || abs(point_a.y - point_b.y) > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                    continue;
+                }
 #            define LED_DISTANCE(led_a, led_b) sqrt16(((int32_t)(led_a.x - led_b.x) * (int32_t)(led_a.x - led_b.x)) + ((int32_t)(led_a.y - led_b.y) * (int32_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
+                uint8_t distance = LED_DISTANCE(point_a, point_b);
 #            undef LED_DISTANCE
                 if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
                     uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
@@ -62,7 +68,7 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     }
 
     // The heatmap animation might run in several iterations depending on
-    // `RGB_MATRIX_LED_PROCESS_LIMIT`, therefore we only want to update the
+    // `RGB_MATRIX_LED_PROCESS_LIMIT` or `RGB_MATRIX_RENDER_BUDGET_US`, therefore we only want to update the
     // timer when the animation starts.
     if (params->iter == 0) {
         decrease_heatmap_values = timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS;
@@ -75,8 +81,8 @@ bool TYPING_HEATMAP(effect_params_t* params) {
 
     // Render heatmap & decrease
     uint8_t count = 0;
-    for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
+    for (uint8_t row = 0; row < MATRIX_ROWS && count < led_max - led_min; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS && count < led_max - led_min; col++) {
             if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
                 count++;
                 uint8_t val = g_rgb_frame_buffer[row][col];
@@ -20,6 +20,9 @@
 #include "progmem.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#include "action_layer.h"
+#include "action_util.h"
+#include "host.h"
 #include "sync_timer.h"
 #include "debug.h"
 #include <string.h>
@@ -34,16 +37,74 @@ const led_point_t k_rgb_matrix_center = {112, 32};
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
-__attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+rgb_t rgb_matrix_hsv_to_rgb_default(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Weak so that keyboards and keymaps can override it, e.g. to scale brightness
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) __attribute__((weak, alias("rgb_matrix_hsv_to_rgb_default")));
+
+void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    // The batched conversion only matches the hook while it has not been overridden
+    if (&rgb_matrix_hsv_to_rgb == &rgb_matrix_hsv_to_rgb_default) {
+        hsv_to_rgb_batch(hsv, rgb, count);
+        return;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
+
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+static uint8_t rgb_geometry_dist[RGB_MATRIX_LED_COUNT];
+static uint8_t rgb_geometry_angle[RGB_MATRIX_LED_COUNT];
+#endif
+
+static uint8_t rgb_matrix_calc_led_dist(uint8_t i) {
+    int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+    int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+    return sqrt16(dx * dx + dy * dy);
+}
+
+static uint8_t rgb_matrix_calc_led_angle(uint8_t i) {
+    int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+    int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+    return atan2_8(dy, dx);
+}
+
+static void rgb_geometry_init(void) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_geometry_dist[i]  = rgb_matrix_calc_led_dist(i);
+        rgb_geometry_angle[i] = rgb_matrix_calc_led_angle(i);
+    }
+#endif
+}
+
+// Distance of the LED from k_rgb_matrix_center
+static inline uint8_t rgb_matrix_led_dist(uint8_t i) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    return rgb_geometry_dist[i];
+#else
+    return rgb_matrix_calc_led_dist(i);
+#endif
+}
+
+// Angle of the LED around k_rgb_matrix_center, as returned by atan2_8()
+static inline uint8_t rgb_matrix_led_angle(uint8_t i) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    return rgb_geometry_angle[i];
+#else
+    return rgb_matrix_calc_led_angle(i);
+#endif
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
 // ------------------------------------------
 // -----Begin rgb effect includes macros-----
-#define RGB_MATRIX_EFFECT(name)
+#define RGB_MATRIX_EFFECT(name, ...)
 #define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
 #include "rgb_matrix_effects.inc"
@@ -97,6 +158,24 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// adaptive render chunking, starting from the static process limit until the effect has been measured
+#    if RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#        define RGB_MATRIX_RENDER_DEFAULT_CHUNK RGB_MATRIX_LED_PROCESS_LIMIT
+#    else
+#        define RGB_MATRIX_RENDER_DEFAULT_CHUNK RGB_MATRIX_LED_COUNT
+#    endif
+static uint8_t  rgb_render_chunk_min;
+static uint8_t  rgb_render_chunk_max;
+static uint8_t  rgb_render_chunk_size  = RGB_MATRIX_RENDER_DEFAULT_CHUNK;
+static uint16_t rgb_render_ns_per_led  = 0;
+static uint32_t rgb_render_sample_ms   = 0;
+static uint32_t rgb_render_sample_leds = 0;
+static uint16_t rgb_render_frames      = 0;
+static uint16_t rgb_render_fps         = 0;
+static uint32_t rgb_render_fps_timer   = 0;
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, rgb_matrix_config);
 
 void eeconfig_force_flush_rgb_matrix(void) {
@@ -152,7 +231,51 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
+#ifdef RGB_MATRIX_POWER_LIMIT
+static const rgb_power_model_t rgb_power_model = {
+    .r    = RGB_MATRIX_POWER_MA_RED,
+    .g    = RGB_MATRIX_POWER_MA_GREEN,
+    .b    = RGB_MATRIX_POWER_MA_BLUE,
+    .idle = RGB_MATRIX_POWER_MA_IDLE,
+};
+
+// The frame as rendered, indexed by driver LED, so that it can be scaled as a whole before it reaches the driver
+static rgb_t                    rgb_power_frame[RGB_MATRIX_LED_COUNT];
+static rgb_matrix_power_stats_t rgb_power_stats = {.scale = RGB_POWER_SCALE_MAX};
+
+static uint8_t rgb_power_led_count(void) {
+#    if defined(RGB_MATRIX_SPLIT)
+    return is_keyboard_left() ? k_rgb_matrix_split[0] : k_rgb_matrix_split[1];
+#    else
+    return RGB_MATRIX_LED_COUNT;
+#    endif
+}
+
+static void rgb_power_limit(void) {
+    uint8_t  count    = rgb_power_led_count();
+    uint32_t estimate = rgb_power_estimate(rgb_power_frame, count, &rgb_power_model);
+    uint16_t scale    = rgb_power_scale(estimate, RGB_MATRIX_POWER_LIMIT, count, &rgb_power_model);
+
+    for (uint8_t i = 0; i < count; i++) {
+        rgb_t rgb = rgb_power_apply(rgb_power_frame[i], scale);
+        rgb_matrix_driver.set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+
+    uint32_t idle             = (uint32_t)RGB_MATRIX_POWER_MA_IDLE * count;
+    rgb_power_stats.requested = MIN(estimate, UINT16_MAX);
+    rgb_power_stats.delivered = MIN(idle + (((estimate - idle) * scale) >> 8), UINT16_MAX);
+    rgb_power_stats.scale     = scale;
+}
+
+void rgb_matrix_get_power_stats(rgb_matrix_power_stats_t *stats) {
+    *stats = rgb_power_stats;
+}
+#endif // RGB_MATRIX_POWER_LIMIT
+
 void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_POWER_LIMIT
+    rgb_power_limit();
+#endif // RGB_MATRIX_POWER_LIMIT
     rgb_matrix_driver.flush();
 }
 
@@ -166,11 +289,18 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_POWER_LIMIT
+    int led = rgb_matrix_led_index(index);
+    if (led >= 0 && led < RGB_MATRIX_LED_COUNT) {
+        rgb_power_frame[led] = (rgb_t){red, green, blue};
+    }
+#else
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
+#endif // RGB_MATRIX_POWER_LIMIT
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_POWER_LIMIT)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -179,6 +309,10 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+    rgb_matrix_invalidate();
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
+
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
 #endif
@@ -280,6 +414,80 @@ static void rgb_task_timers(void) {
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+// Everything a static effect and the indicators are expected to draw from
+typedef struct {
+    rgb_config_t  config;
+    uint8_t       effect;
+    uint8_t       host_leds;
+    uint8_t       mods;
+    layer_state_t layers;
+    layer_state_t default_layers;
+} rgb_static_state_t;
+
+static rgb_static_state_t rgb_static_shown;
+static bool               rgb_static_valid = false;
+
+static bool rgb_matrix_effect_is_static(uint8_t effect) {
+    switch (effect) {
+        case RGB_MATRIX_NONE:
+            return true;
+
+#    define RGB_MATRIX_EFFECT(name, ...) \
+        case RGB_MATRIX_##name:          \
+            return (__VA_ARGS__ + 0) & RGB_MATRIX_EFFECT_STATIC;
+#    include "rgb_matrix_effects.inc"
+#    undef RGB_MATRIX_EFFECT
+
+#    ifdef COMMUNITY_MODULES_ENABLE
+#        define RGB_MATRIX_EFFECT(name, ...)         \
+            case RGB_MATRIX_COMMUNITY_MODULE_##name: \
+                return (__VA_ARGS__ + 0) & RGB_MATRIX_EFFECT_STATIC;
+#        include "rgb_matrix_community_modules.inc"
+#        undef RGB_MATRIX_EFFECT
+#    endif // COMMUNITY_MODULES_ENABLE
+
+#    if defined(RGB_MATRIX_CUSTOM_KB) || defined(RGB_MATRIX_CUSTOM_USER)
+#        define RGB_MATRIX_EFFECT(name, ...) \
+            case RGB_MATRIX_CUSTOM_##name:   \
+                return (__VA_ARGS__ + 0) & RGB_MATRIX_EFFECT_STATIC;
+#        ifdef RGB_MATRIX_CUSTOM_KB
+#            include "rgb_matrix_kb.inc"
+#        endif
+#        ifdef RGB_MATRIX_CUSTOM_USER
+#            include "rgb_matrix_user.inc"
+#        endif
+#        undef RGB_MATRIX_EFFECT
+#    endif // RGB_MATRIX_CUSTOM_KB || RGB_MATRIX_CUSTOM_USER
+
+        default:
+            return false;
+    }
+}
+
+// Returns true if the frame about to be rendered would be identical to the one already shown
+static bool rgb_static_frame_shown(void) {
+    rgb_static_state_t state = {
+        .config         = rgb_matrix_config,
+        .effect         = rgb_current_effect,
+        .host_leds      = host_keyboard_leds(),
+        .mods           = get_mods() | get_oneshot_mods(),
+        .layers         = layer_state,
+        .default_layers = default_layer_state,
+    };
+
+    bool shown = rgb_static_valid && rgb_static_shown.config.raw == state.config.raw && rgb_static_shown.effect == state.effect && rgb_static_shown.host_leds == state.host_leds && rgb_static_shown.mods == state.mods && rgb_static_shown.layers == state.layers && rgb_static_shown.default_layers == state.default_layers;
+
+    rgb_static_shown = state;
+    rgb_static_valid = rgb_matrix_effect_is_static(state.effect);
+    return shown;
+}
+
+void rgb_matrix_invalidate(void) {
+    rgb_static_valid = false;
+}
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
+
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
     // next task
@@ -307,10 +515,86 @@ static void rgb_task_start(void) {
     // Set effect to be renedered
     rgb_current_effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
 
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+    // Nothing the frame depends on has changed, keep showing it
+    if (rgb_static_frame_shown()) {
+        rgb_task_state = SYNCING;
+        return;
+    }
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
+
     // next task
     rgb_task_state = RENDERING;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static void rgb_render_reset(void) {
+    rgb_render_chunk_size  = RGB_MATRIX_RENDER_DEFAULT_CHUNK;
+    rgb_render_ns_per_led  = 0;
+    rgb_render_sample_ms   = 0;
+    rgb_render_sample_leds = 0;
+    rgb_render_frames      = 0;
+    rgb_render_fps         = 0;
+    rgb_render_fps_timer   = timer_read32();
+}
+
+static void rgb_render_begin_chunk(uint8_t iter) {
+    uint8_t first = 0;
+    uint8_t last  = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        last = k_rgb_matrix_split[0];
+    } else {
+        first = k_rgb_matrix_split[0];
+    }
+#    endif
+    rgb_render_chunk_min = (iter == 0) ? first : rgb_render_chunk_max;
+    rgb_render_chunk_max = MIN((uint16_t)rgb_render_chunk_min + rgb_render_chunk_size, last);
+}
+
+static void rgb_render_end_chunk(uint32_t start) {
+    // The millisecond timer is far too coarse to time a single chunk, but the number of ticks it advances while
+    // rendering is on average proportional to the time spent. Summing over many chunks gives a usable estimate.
+    rgb_render_sample_ms += timer_elapsed32(start);
+    rgb_render_sample_leds += rgb_render_chunk_max - rgb_render_chunk_min;
+}
+
+static void rgb_render_end_frame(void) {
+    rgb_render_frames++;
+    uint32_t elapsed     = timer_elapsed32(rgb_render_fps_timer);
+    bool     second_done = elapsed >= 1000;
+    if (second_done) {
+        rgb_render_fps       = ((uint32_t)rgb_render_frames * 1000) / elapsed;
+        rgb_render_frames    = 0;
+        rgb_render_fps_timer = timer_read32();
+    }
+
+    if (rgb_render_sample_leds == 0 || !(second_done || rgb_render_sample_ms >= RGB_MATRIX_RENDER_SAMPLE_MS)) {
+        return;
+    }
+
+    // A sample cut short by the end of the second may have caught few or no ticks, which would make the effect look
+    // free. Counting one tick more than seen gives an upper bound instead, which tightens as more ticks are caught.
+    uint32_t sample_ms     = rgb_render_sample_ms < RGB_MATRIX_RENDER_SAMPLE_MS ? rgb_render_sample_ms + 1 : rgb_render_sample_ms;
+    rgb_render_ns_per_led  = MAX(MIN((sample_ms * 1000000) / rgb_render_sample_leds, UINT16_MAX), 1);
+    rgb_render_sample_ms   = 0;
+    rgb_render_sample_leds = 0;
+
+    // Pick the chunk size which fits within the budget, always making some progress. Chunks shrink straight away, but
+    // only grow by doubling, so one noisy sample can't jump straight to rendering every LED at once.
+    uint32_t chunk        = ((uint32_t)RGB_MATRIX_RENDER_BUDGET_US * 1000) / rgb_render_ns_per_led;
+    chunk                 = MIN(chunk, (uint32_t)rgb_render_chunk_size * 2);
+    rgb_render_chunk_size = MAX(MIN(chunk, RGB_MATRIX_LED_COUNT), 1);
+}
+
+void rgb_matrix_get_render_stats(rgb_matrix_render_stats_t *stats) {
+    stats->effect     = rgb_last_effect;
+    stats->chunk_size = rgb_render_chunk_size;
+    stats->fps        = rgb_render_fps;
+    stats->ns_per_led = rgb_render_ns_per_led;
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
@@ -319,6 +603,15 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    // Costs are per-effect, start measuring from scratch whenever the effect changes
+    if (rgb_effect_params.init && rgb_effect_params.iter == 0) {
+        rgb_render_reset();
+    }
+    rgb_render_begin_chunk(rgb_effect_params.iter);
+    uint32_t render_start = timer_read32();
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -368,6 +661,10 @@ static void rgb_task_render(uint8_t effect) {
             return;
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_end_chunk(render_start);
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
     rgb_effect_params.iter++;
 
     // next task
@@ -388,6 +685,10 @@ static void rgb_task_flush(uint8_t effect) {
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_end_frame();
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
     // next task
     rgb_task_state = SYNCING;
 }
@@ -438,7 +739,12 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+    // Chunk sizes vary from frame to frame, so the limits are those of the chunk currently being rendered
+    (void)iter;
+    limits.led_min_index = rgb_render_chunk_min;
+    limits.led_max_index = rgb_render_chunk_max;
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
@@ -489,6 +795,7 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+    rgb_geometry_init();
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
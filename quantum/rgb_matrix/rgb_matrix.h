@@ -90,6 +90,46 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+// Effect runners keep this many LEDs on the stack (7 bytes each) while batching their HSV to RGB conversions
+#ifndef RGB_MATRIX_HSV_ROW_SIZE
+#    ifdef __AVR__
+#        define RGB_MATRIX_HSV_ROW_SIZE 4
+#    else
+#        define RGB_MATRIX_HSV_ROW_SIZE 16
+#    endif
+#endif
+#if RGB_MATRIX_HSV_ROW_SIZE < 1 || RGB_MATRIX_HSV_ROW_SIZE > 32
+#    error RGB_MATRIX_HSV_ROW_SIZE must be between 1 and 32
+#endif
+
+// Cache each LED's distance and angle from the center, costing 2 bytes of RAM per LED
+#if !defined(RGB_MATRIX_GEOMETRY_CACHE) && !defined(__AVR__)
+#    define RGB_MATRIX_GEOMETRY_CACHE
+#endif
+
+#ifdef RGB_MATRIX_POWER_LIMIT
+// Current drawn by each channel of an LED at full brightness, and by a dark LED, in mA
+#    ifndef RGB_MATRIX_POWER_MA_RED
+#        define RGB_MATRIX_POWER_MA_RED 16
+#    endif
+#    ifndef RGB_MATRIX_POWER_MA_GREEN
+#        define RGB_MATRIX_POWER_MA_GREEN 11
+#    endif
+#    ifndef RGB_MATRIX_POWER_MA_BLUE
+#        define RGB_MATRIX_POWER_MA_BLUE 15
+#    endif
+#    ifndef RGB_MATRIX_POWER_MA_IDLE
+#        define RGB_MATRIX_POWER_MA_IDLE 1
+#    endif
+#endif
+
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// Minimum number of milliseconds of render time to accumulate before re-estimating the per-LED cost
+#    ifndef RGB_MATRIX_RENDER_SAMPLE_MS
+#        define RGB_MATRIX_RENDER_SAMPLE_MS 16
+#    endif
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -114,6 +154,10 @@ struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 #define RGB_MATRIX_TEST_LED_FLAGS() \
     if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
 
+// Passed as the second argument of RGB_MATRIX_EFFECT() by effects whose frames only depend on the configuration,
+// not on time or key presses
+#define RGB_MATRIX_EFFECT_STATIC 1
+
 enum rgb_matrix_effects {
     RGB_MATRIX_NONE = 0,
 
@@ -228,6 +272,31 @@ void        rgb_matrix_update_pwm_buffers(void);
 const char *rgb_matrix_get_mode_name(uint8_t mode);
 #endif // RGB_MATRIX_MODE_NAME_ENABLE
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+typedef struct rgb_matrix_render_stats_t {
+    uint8_t  effect;     // effect the statistics were measured against
+    uint8_t  chunk_size; // number of LEDs rendered per task run
+    uint16_t fps;        // frames flushed during the last second
+    uint16_t ns_per_led; // estimated render cost per LED, in nanoseconds
+} rgb_matrix_render_stats_t;
+
+void rgb_matrix_get_render_stats(rgb_matrix_render_stats_t *stats);
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+void rgb_matrix_invalidate(void);
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
+
+#ifdef RGB_MATRIX_POWER_LIMIT
+typedef struct rgb_matrix_power_stats_t {
+    uint16_t requested; // estimated current of the last frame as rendered, in mA
+    uint16_t delivered; // estimated current of the last frame once limited, in mA
+    uint16_t scale;     // brightness scale applied, out of RGB_POWER_SCALE_MAX
+} rgb_matrix_power_stats_t;
+
+void rgb_matrix_get_power_stats(rgb_matrix_power_stats_t *stats);
+#endif // RGB_MATRIX_POWER_LIMIT
+
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_force_flush_rgb_matrix
 #    define rgblight_reload_from_eeprom rgb_matrix_reload_from_eeprom
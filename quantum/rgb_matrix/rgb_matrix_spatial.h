@@ -0,0 +1,69 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "rgb_matrix_types.h"
+#include "util.h"
+
+/*
+ * Coarse grid over the LED coordinate space, used by reactive effects to skip hits which cannot reach an LED.
+ *
+ * The x axis (0..255) is split into cells of (1 << RGB_MATRIX_SPATIAL_CELL_SHIFT) units. The y axis uses the same
+ * cell size for RGB_MATRIX_SPATIAL_GRID_ROWS rows, with anything further down clamped into the last row -- clamping
+ * only ever makes a cell cover more area, so range checks stay conservative.
+ */
+
+#ifndef RGB_MATRIX_SPATIAL_CELL_SHIFT
+#    define RGB_MATRIX_SPATIAL_CELL_SHIFT 5
+#endif // RGB_MATRIX_SPATIAL_CELL_SHIFT
+
+#ifndef RGB_MATRIX_SPATIAL_GRID_ROWS
+#    define RGB_MATRIX_SPATIAL_GRID_ROWS 3
+#endif // RGB_MATRIX_SPATIAL_GRID_ROWS
+
+#define RGB_MATRIX_SPATIAL_GRID_COLS (256 >> RGB_MATRIX_SPATIAL_CELL_SHIFT)
+#define RGB_MATRIX_SPATIAL_CELL_COUNT (RGB_MATRIX_SPATIAL_GRID_COLS * RGB_MATRIX_SPATIAL_GRID_ROWS)
+
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+// One bit per entry in g_last_hit_tracker
+#    if LED_HITS_TO_REMEMBER <= 8
+typedef uint8_t rgb_matrix_hit_mask_t;
+#    elif LED_HITS_TO_REMEMBER <= 16
+typedef uint16_t rgb_matrix_hit_mask_t;
+#    elif LED_HITS_TO_REMEMBER <= 32
+typedef uint32_t rgb_matrix_hit_mask_t;
+#    else
+#        error LED_HITS_TO_REMEMBER must not exceed 32
+#    endif
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
+static inline uint8_t rgb_matrix_spatial_col(uint8_t x) {
+    return x >> RGB_MATRIX_SPATIAL_CELL_SHIFT;
+}
+
+static inline uint8_t rgb_matrix_spatial_row(uint8_t y) {
+    return MIN(y >> RGB_MATRIX_SPATIAL_CELL_SHIFT, RGB_MATRIX_SPATIAL_GRID_ROWS - 1);
+}
+
+// Returns the grid cell containing the supplied point
+static inline uint8_t rgb_matrix_spatial_cell(led_point_t point) {
+    return rgb_matrix_spatial_row(point.y) * RGB_MATRIX_SPATIAL_GRID_COLS + rgb_matrix_spatial_col(point.x);
+}
+
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+// Marks hit `hit` in every cell that intersects the square of `radius` around (x, y)
+static inline void rgb_matrix_spatial_mark_hit(rgb_matrix_hit_mask_t *cells, uint8_t hit, uint8_t x, uint8_t y, uint8_t radius) {
+    uint8_t col_min = rgb_matrix_spatial_col(x > radius ? x - radius : 0);
+    uint8_t col_max = rgb_matrix_spatial_col(MIN(x + radius, UINT8_MAX));
+    uint8_t row_min = rgb_matrix_spatial_row(y > radius ? y - radius : 0);
+    uint8_t row_max = rgb_matrix_spatial_row(MIN(y + radius, UINT8_MAX));
+    for (uint8_t row = row_min; row <= row_max; row++) {
+        for (uint8_t col = col_min; col <= col_max; col++) {
+            cells[row * RGB_MATRIX_SPATIAL_GRID_COLS + col] |= (rgb_matrix_hit_mask_t)1 << hit;
+        }
+    }
+}
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
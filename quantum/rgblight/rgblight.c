@@ -113,6 +113,11 @@ static bool pre_suspend_enabled;
 animation_status_t animation_status = {};
 #endif
 
+// Set whenever the effect range may hold colours the running effect did not draw,
+// so that effects which only redraw changed LEDs repaint the whole range instead
+static bool                   effect_repaint = true;
+static rgblight_effect_cost_t effect_cost;
+
 #ifdef RGBLIGHT_LAYERS
 rgblight_segment_t const *const *rgblight_layers = NULL;
 
@@ -124,6 +129,7 @@ rgblight_ranges_t rgblight_ranges = {0, RGBLIGHT_LED_COUNT, 0, RGBLIGHT_LED_COUN
 void rgblight_set_clipping_range(uint8_t start_pos, uint8_t num_leds) {
     rgblight_ranges.clipping_start_pos = start_pos;
     rgblight_ranges.clipping_num_leds  = num_leds;
+    effect_repaint                     = true;
 }
 
 void rgblight_set_effect_range(uint8_t start_pos, uint8_t num_leds) {
@@ -132,12 +138,16 @@ void rgblight_set_effect_range(uint8_t start_pos, uint8_t num_leds) {
     rgblight_ranges.effect_start_pos = start_pos;
     rgblight_ranges.effect_end_pos   = start_pos + num_leds;
     rgblight_ranges.effect_num_leds  = num_leds;
+    effect_repaint                   = true;
 }
 
-__attribute__((weak)) rgb_t rgblight_hsv_to_rgb(hsv_t hsv) {
+rgb_t rgblight_hsv_to_rgb_default(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Weak so that keyboards and keymaps can override it
+rgb_t rgblight_hsv_to_rgb(hsv_t hsv) __attribute__((weak, alias("rgblight_hsv_to_rgb_default")));
+
 uint8_t rgblight_led_index(uint8_t index) {
 #if defined(RGBLIGHT_LED_MAP)
     return pgm_read_byte(&led_map[index]) - rgblight_ranges.clipping_start_pos;
@@ -146,13 +156,58 @@ uint8_t rgblight_led_index(uint8_t index) {
 #endif
 }
 
+#ifdef RGBLIGHT_POWER_LIMIT
+static const rgb_power_model_t power_model = {
+    .r    = RGBLIGHT_POWER_MA_RED,
+    .g    = RGBLIGHT_POWER_MA_GREEN,
+    .b    = RGBLIGHT_POWER_MA_BLUE,
+    .idle = RGBLIGHT_POWER_MA_IDLE,
+};
+
+// The frame as drawn, indexed by driver LED, so that it can be scaled as a whole before it reaches the driver
+static rgb_t                  power_frame[RGBLIGHT_LED_COUNT];
+static rgblight_power_stats_t power_stats = {.scale = RGB_POWER_SCALE_MAX};
+
+static void power_limit(void) {
+    uint8_t  count    = rgblight_ranges.clipping_num_leds;
+    uint32_t estimate = rgb_power_estimate(power_frame, count, &power_model);
+    uint16_t scale    = rgb_power_scale(estimate, RGBLIGHT_POWER_LIMIT, count, &power_model);
+
+    for (uint8_t i = 0; i < count; i++) {
+        rgb_t rgb = rgb_power_apply(power_frame[i], scale);
+        rgblight_driver.set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+
+    uint32_t idle         = (uint32_t)RGBLIGHT_POWER_MA_IDLE * count;
+    power_stats.requested = MIN(estimate, UINT16_MAX);
+    power_stats.delivered = MIN(idle + (((estimate - idle) * scale) >> 8), UINT16_MAX);
+    power_stats.scale     = scale;
+}
+
+void rgblight_get_power_stats(rgblight_power_stats_t *stats) {
+    *stats = power_stats;
+}
+#endif
+
+static inline void led_set_color(uint8_t led, uint8_t r, uint8_t g, uint8_t b) {
+#ifdef RGBLIGHT_POWER_LIMIT
+    if (led < RGBLIGHT_LED_COUNT) {
+        power_frame[led] = (rgb_t){r, g, b};
+    }
+#else
+    rgblight_driver.set_color(led, r, g, b);
+#endif
+}
+
 void setrgb(uint8_t r, uint8_t g, uint8_t b, int index) {
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    effect_cost.written++;
+    led_set_color(rgblight_led_index(index), r, g, b);
 }
 
 void sethsv_raw(uint8_t hue, uint8_t sat, uint8_t val, int index) {
     hsv_t hsv = {hue, sat, val};
     rgb_t rgb = rgblight_hsv_to_rgb(hsv);
+    effect_cost.converted++;
     setrgb(rgb.r, rgb.g, rgb.b, index);
 }
 
@@ -160,6 +215,41 @@ void sethsv(uint8_t hue, uint8_t sat, uint8_t val, int index) {
     sethsv_raw(hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val, index);
 }
 
+#if defined(RGBLIGHT_EFFECT_KNIGHT) || defined(RGBLIGHT_EFFECT_CHRISTMAS) || defined(RGBLIGHT_EFFECT_ALTERNATING)
+// Converts a colour once, for effects that paint it onto several LEDs
+static rgb_t effect_hsv_to_rgb(uint8_t hue, uint8_t sat, uint8_t val) {
+    effect_cost.converted++;
+    return rgblight_hsv_to_rgb((hsv_t){hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val});
+}
+#endif
+
+#ifdef RGBLIGHT_EFFECT_RAINBOW_SWIRL
+// Same as calling sethsv() for `count` consecutive LEDs starting at `index`
+static void sethsv_batch(hsv_t *hsv, uint8_t count, uint8_t index) {
+    rgb_t rgb[RGBLIGHT_HSV_BATCH_SIZE];
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (hsv[i].v > RGBLIGHT_LIMIT_VAL) {
+            hsv[i].v = RGBLIGHT_LIMIT_VAL;
+        }
+    }
+
+    // The batched conversion only matches the hook while it has not been overridden
+    if (&rgblight_hsv_to_rgb == &rgblight_hsv_to_rgb_default) {
+        hsv_to_rgb_batch(hsv, rgb, count);
+    } else {
+        for (uint8_t i = 0; i < count; i++) {
+            rgb[i] = rgblight_hsv_to_rgb(hsv[i]);
+        }
+    }
+    effect_cost.converted += count;
+
+    for (uint8_t i = 0; i < count; i++) {
+        setrgb(rgb[i].r, rgb[i].g, rgb[i].b, index + i);
+    }
+}
+#endif
+
 void rgblight_check_config(void) {
     /* Add some out of bound checks for RGB light config */
 
@@ -497,6 +587,7 @@ void rgblight_decrease_speed_noeeprom(void) {
 void rgblight_sethsv_noeeprom_old(uint8_t hue, uint8_t sat, uint8_t val) {
     if (rgblight_config.enable) {
         rgb_t rgb = rgblight_hsv_to_rgb((hsv_t){hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val});
+        effect_cost.converted++;
         rgblight_setrgb(rgb.r, rgb.g, rgb.b);
     }
 }
@@ -622,14 +713,19 @@ hsv_t rgblight_get_hsv(void) {
     return (hsv_t){rgblight_config.hue, rgblight_config.sat, rgblight_config.val};
 }
 
+rgblight_effect_cost_t rgblight_get_effect_cost(void) {
+    return effect_cost;
+}
+
 void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b) {
     if (!rgblight_config.enable) {
         return;
     }
 
     for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        led_set_color(rgblight_led_index(i), r, g, b);
     }
+    effect_cost.written += rgblight_ranges.effect_num_leds;
     rgblight_set();
 }
 
@@ -638,7 +734,8 @@ void rgblight_setrgb_at(uint8_t r, uint8_t g, uint8_t b, uint8_t index) {
         return;
     }
 
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    led_set_color(rgblight_led_index(index), r, g, b);
+    effect_repaint = true;
     rgblight_set();
 }
 
@@ -669,8 +766,9 @@ void rgblight_setrgb_range(uint8_t r, uint8_t g, uint8_t b, uint8_t start, uint8
     }
 
     for (uint8_t i = start; i < end; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        led_set_color(rgblight_led_index(i), r, g, b);
     }
+    effect_repaint = true;
     rgblight_set();
 }
 
@@ -717,6 +815,7 @@ void rgblight_set_layer_state(uint8_t layer, bool enabled) {
     // set a flag and do it the next time rgblight_task() runs.
 
     deferred_set_layer_state = true;
+    effect_repaint           = true;
 }
 
 bool rgblight_get_layer_state(uint8_t layer) {
@@ -861,7 +960,7 @@ void rgblight_wakeup(void) {
 void rgblight_set(void) {
     if (!rgblight_config.enable) {
         for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-            rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+            led_set_color(rgblight_led_index(i), 0, 0, 0);
         }
     }
 
@@ -877,6 +976,9 @@ void rgblight_set(void) {
     }
 #endif
 
+#ifdef RGBLIGHT_POWER_LIMIT
+    power_limit();
+#endif
     rgblight_driver.flush();
 }
 
@@ -1055,6 +1157,7 @@ void rgblight_timer_task(void) {
             animation_status.restart    = false;
             animation_status.last_timer = sync_timer_read();
             animation_status.pos16      = 0; // restart signal to local each effect
+            effect_repaint              = true;
         }
         uint16_t now = sync_timer_read();
         if (timer_expired(now, animation_status.last_timer)) {
@@ -1073,7 +1176,9 @@ void rgblight_timer_task(void) {
             oldpos16 = animation_status.pos16;
 #    endif
             animation_status.last_timer += interval_time;
+            effect_cost = (rgblight_effect_cost_t){0};
             effect_func(&animation_status);
+            effect_repaint = false;
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
             if (animation_status.pos16 == 0 && oldpos16 != 0) {
                 tick_flag = true;
@@ -1156,12 +1261,15 @@ void rgblight_effect_rainbow_mood(animation_status_t *anim) {
 __attribute__((weak)) const uint8_t RGBLED_RAINBOW_SWIRL_INTERVALS[] PROGMEM = {100, 50, 20};
 
 void rgblight_effect_rainbow_swirl(animation_status_t *anim) {
-    uint8_t hue;
-    uint8_t i;
+    hsv_t   hsv[RGBLIGHT_HSV_BATCH_SIZE];
+    uint8_t count = 0;
 
-    for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        hue = (RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i + anim->current_hue);
-        sethsv(hue, rgblight_config.sat, rgblight_config.val, i + rgblight_ranges.effect_start_pos);
+    for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
+        hsv[count++] = (hsv_t){RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i + anim->current_hue, rgblight_config.sat, rgblight_config.val};
+        if (count == RGBLIGHT_HSV_BATCH_SIZE || i == rgblight_ranges.effect_num_leds - 1) {
+            sethsv_batch(hsv, count, i + 1 - count + rgblight_ranges.effect_start_pos);
+            count = 0;
+        }
     }
     rgblight_set();
 
@@ -1178,6 +1286,7 @@ __attribute__((weak)) const uint8_t RGBLED_SNAKE_INTERVALS[] PROGMEM = {100, 50,
 
 void rgblight_effect_snake(animation_status_t *anim) {
     static uint8_t pos = 0;
+    static uint8_t snake_lit[RGBLIGHT_EFFECT_SNAKE_LENGTH];
     uint8_t        i, j;
     int8_t         k;
     int8_t         increment = 1;
@@ -1197,22 +1306,43 @@ void rgblight_effect_snake(animation_status_t *anim) {
     }
 #    endif
 
-    for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
+    // Work out which LEDs the snake covers this step
+    uint8_t lit[RGBLIGHT_EFFECT_SNAKE_LENGTH];
+    for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
+        k = pos + j * increment;
+        if (k > RGBLIGHT_LED_COUNT) {
+            k = k % (RGBLIGHT_LED_COUNT);
+        }
+        if (k < 0) {
+            k = k + rgblight_ranges.effect_num_leds;
+        }
+        lit[j] = (k >= 0 && k < rgblight_ranges.effect_num_leds) ? k : UINT8_MAX;
+    }
 
-        for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
-            k = pos + j * increment;
-            if (k > RGBLIGHT_LED_COUNT) {
-                k = k % (RGBLIGHT_LED_COUNT);
-            }
-            if (k < 0) {
-                k = k + rgblight_ranges.effect_num_leds;
+    // Only the LEDs the snake has just left need turning off
+    if (effect_repaint) {
+        for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
+            setrgb(0, 0, 0, i + rgblight_ranges.effect_start_pos);
+        }
+    } else {
+        for (i = 0; i < RGBLIGHT_EFFECT_SNAKE_LENGTH; i++) {
+            bool still_lit = false;
+            for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
+                still_lit |= (lit[j] == snake_lit[i]);
             }
-            if (i == k) {
-                sethsv(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH), i + rgblight_ranges.effect_start_pos);
+            if (!still_lit && snake_lit[i] < rgblight_ranges.effect_num_leds) {
+                setrgb(0, 0, 0, snake_lit[i] + rgblight_ranges.effect_start_pos);
             }
         }
     }
+
+    // Later segments are dimmer, and win where the snake overlaps itself
+    for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
+        if (lit[j] != UINT8_MAX) {
+            sethsv(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH), lit[j] + rgblight_ranges.effect_start_pos);
+        }
+        snake_lit[j] = lit[j];
+    }
     rgblight_set();
     if (increment == 1) {
         if (pos - RGBLIGHT_EFFECT_SNAKE_INCREMENT < 0) {
@@ -1252,18 +1382,21 @@ void rgblight_effect_knight(animation_status_t *anim) {
         increment  = 1;
     }
 #    endif
-    // Set all the LEDs to 0
-    for (i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+    // LEDs outside the knight's track never light up, so only clear them when repainting
+    if (effect_repaint) {
+        for (i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
+            setrgb(0, 0, 0, i);
+        }
     }
     // Determine which LEDs should be lit up
+    rgb_t rgb = effect_hsv_to_rgb(rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
         cur = (i + RGBLIGHT_EFFECT_KNIGHT_OFFSET) % rgblight_ranges.effect_num_leds + rgblight_ranges.effect_start_pos;
 
         if (i >= low_bound && i <= high_bound) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, cur);
+            setrgb(rgb.r, rgb.g, rgb.b, cur);
         } else {
-            rgblight_driver.set_color(rgblight_led_index(cur), 0, 0, 0);
+            setrgb(0, 0, 0, cur);
         }
     }
     rgblight_set();
@@ -1306,9 +1439,12 @@ void rgblight_effect_christmas(animation_status_t *anim) {
     // Additionally, these interpolated colors get shown with a slightly darker value, to make them less prominent than the main colors.
     val = 255 - (3 * (hue < hue_green / 2 ? hue : hue_green - hue) / 2);
 
+    // Only two colours are shown at a time
+    rgb_t rgb_a = effect_hsv_to_rgb(hue, rgblight_config.sat, val);
+    rgb_t rgb_b = effect_hsv_to_rgb(hue_green - hue, rgblight_config.sat, val);
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        uint8_t local_hue = (i / RGBLIGHT_EFFECT_CHRISTMAS_STEP) % 2 ? hue : hue_green - hue;
-        sethsv(local_hue, rgblight_config.sat, val, i + rgblight_ranges.effect_start_pos);
+        rgb_t *rgb = (i / RGBLIGHT_EFFECT_CHRISTMAS_STEP) % 2 ? &rgb_a : &rgb_b;
+        setrgb(rgb->r, rgb->g, rgb->b, i + rgblight_ranges.effect_start_pos);
     }
     rgblight_set();
 
@@ -1337,14 +1473,12 @@ void rgblight_effect_rgbtest(animation_status_t *anim) {
 
 #ifdef RGBLIGHT_EFFECT_ALTERNATING
 void rgblight_effect_alternating(animation_status_t *anim) {
+    rgb_t on  = effect_hsv_to_rgb(rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
+    rgb_t off = effect_hsv_to_rgb(rgblight_config.hue, rgblight_config.sat, 0);
     for (int i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        if (i < rgblight_ranges.effect_num_leds / 2 && anim->pos) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, i + rgblight_ranges.effect_start_pos);
-        } else if (i >= rgblight_ranges.effect_num_leds / 2 && !anim->pos) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, i + rgblight_ranges.effect_start_pos);
-        } else {
-            sethsv(rgblight_config.hue, rgblight_config.sat, 0, i + rgblight_ranges.effect_start_pos);
-        }
+        bool   lit = (i < rgblight_ranges.effect_num_leds / 2) ? anim->pos : !anim->pos;
+        rgb_t *rgb = lit ? &on : &off;
+        setrgb(rgb->r, rgb->g, rgb->b, i + rgblight_ranges.effect_start_pos);
     }
     rgblight_set();
     anim->pos = (anim->pos + 1) % 2;
@@ -1380,8 +1514,9 @@ void rgblight_effect_twinkle(animation_status_t *anim) {
     const uint8_t trigger = scale((uint16_t)0xFF * RGBLIGHT_EFFECT_TWINKLE_PROBABILITY, 127 + rgblight_config.val / 2);
 
     for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        TwinkleState *t = &(led_twinkle_state[i]);
-        hsv_t        *c = &(t->hsv);
+        TwinkleState *t    = &(led_twinkle_state[i]);
+        hsv_t        *c    = &(t->hsv);
+        hsv_t         last = *c;
 
         if (!random_color) {
             c->h = rgblight_config.hue;
@@ -1410,7 +1545,10 @@ void rgblight_effect_twinkle(animation_status_t *anim) {
             // This LED is off, and was NOT selected to start brightening
         }
 
-        sethsv(c->h, c->s, c->v, i + rgblight_ranges.effect_start_pos);
+        // Most LEDs are idle on any given step, only send the ones that changed
+        if (effect_repaint || restart || c->h != last.h || c->s != last.s || c->v != last.v) {
+            sethsv(c->h, c->s, c->v, i + rgblight_ranges.effect_start_pos);
+        }
     }
 
     rgblight_set();
@@ -166,6 +166,34 @@ enum RGBLIGHT_EFFECT_MODE {
 #    define RGBLIGHT_LIMIT_VAL 255
 #endif
 
+// LEDs converted from HSV to RGB at a time, costing 6 bytes of stack each
+#ifndef RGBLIGHT_HSV_BATCH_SIZE
+#    ifdef __AVR__
+#        define RGBLIGHT_HSV_BATCH_SIZE 4
+#    else
+#        define RGBLIGHT_HSV_BATCH_SIZE 16
+#    endif
+#endif
+#if RGBLIGHT_HSV_BATCH_SIZE < 1 || RGBLIGHT_HSV_BATCH_SIZE > 32
+#    error RGBLIGHT_HSV_BATCH_SIZE must be between 1 and 32
+#endif
+
+#ifdef RGBLIGHT_POWER_LIMIT
+/* Current drawn by each channel of an LED at full brightness, and by a dark LED, in mA */
+#    ifndef RGBLIGHT_POWER_MA_RED
+#        define RGBLIGHT_POWER_MA_RED 16
+#    endif
+#    ifndef RGBLIGHT_POWER_MA_GREEN
+#        define RGBLIGHT_POWER_MA_GREEN 11
+#    endif
+#    ifndef RGBLIGHT_POWER_MA_BLUE
+#        define RGBLIGHT_POWER_MA_BLUE 15
+#    endif
+#    ifndef RGBLIGHT_POWER_MA_IDLE
+#        define RGBLIGHT_POWER_MA_IDLE 1
+#    endif
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "rgblight_drivers.h"
@@ -285,6 +313,17 @@ typedef struct _rgblight_ranges_t {
 
 extern rgblight_ranges_t rgblight_ranges;
 
+typedef struct _rgblight_effect_cost_t {
+    uint16_t converted; /* HSV to RGB conversions */
+    uint16_t written;   /* LEDs sent to the driver */
+} rgblight_effect_cost_t;
+
+typedef struct _rgblight_power_stats_t {
+    uint16_t requested; /* estimated current of the last frame as drawn, in mA */
+    uint16_t delivered; /* estimated current of the last frame once limited, in mA */
+    uint16_t scale;     /* brightness scale applied, out of RGB_POWER_SCALE_MAX */
+} rgblight_power_stats_t;
+
 /* === Low level Functions === */
 void rgblight_set(void);
 void rgblight_set_clipping_range(uint8_t start_pos, uint8_t num_leds);
@@ -362,6 +401,14 @@ uint8_t rgblight_get_val(void);
 bool    rgblight_is_enabled(void);
 hsv_t   rgblight_get_hsv(void);
 
+/* Work done by the most recent animation step */
+rgblight_effect_cost_t rgblight_get_effect_cost(void);
+
+#ifdef RGBLIGHT_POWER_LIMIT
+/* Current estimate of the most recently flushed frame */
+void rgblight_get_power_stats(rgblight_power_stats_t *stats);
+#endif
+
 /* === qmk_firmware (core)internal Functions === */
 void     rgblight_init(void);
 void     rgblight_suspend(void);
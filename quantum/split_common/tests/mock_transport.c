@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "debug.h"
+#include "pointing_device.h"
+#include "mock_transport.h"
+
+static split_shared_memory_t master_memory;
+split_shared_memory_t *const split_shmem = &master_memory;
+
+split_shared_memory_t mock_slave_memory;
+uint32_t              mock_transaction_count[NUM_TOTAL_TRANSACTIONS];
+
+debug_config_t                  debug_config;
+const pointing_device_driver_t *pointing_device_driver;
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    mock_transaction_count[id]++;
+
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+    }
+
+    // Across the wire and back, the slave side runs no callbacks
+    memcpy((uint8_t *)&mock_slave_memory + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    memcpy(split_trans_target2initiator_buffer(trans), (uint8_t *)&mock_slave_memory + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+
+    if (target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    }
+    return true;
+}
+
+// The master is the left half, the pointing device is on the right
+bool is_keyboard_left(void) {
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+void split_shared_memory_lock(void) {}
+
+void split_shared_memory_unlock(void) {}
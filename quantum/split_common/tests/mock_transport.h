@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "transactions.h"
+
+// The shared memory of the other half, which transactions are exchanged with
+extern split_shared_memory_t mock_slave_memory;
+
+// Number of times each transaction has been executed
+extern uint32_t mock_transaction_count[NUM_TOTAL_TRANSACTIONS];
@@ -0,0 +1,10 @@
+split_pointing_DEFS := -DSPLIT_KEYBOARD -DPOINTING_DEVICE_ENABLE -DSPLIT_POINTING_ENABLE -DPOINTING_DEVICE_RIGHT -DDISABLE_SYNC_TIMER -DMATRIX_ROWS=4 -DMATRIX_COLS=4
+split_pointing_INC := $(QUANTUM_PATH)/split_common $(QUANTUM_PATH)/pointing_device
+
+split_pointing_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/mock_transport.c \
+	$(QUANTUM_PATH)/split_common/tests/split_pointing_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1,87 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "crc.h"
+#include "pointing_device.h"
+#include "mock_transport.h"
+}
+
+static std::vector<report_mouse_t> shared_reports;
+
+extern "C" bool pointing_device_add_shared_report(report_mouse_t report) {
+    shared_reports.push_back(report);
+    return true;
+}
+
+extern "C" uint16_t pointing_device_get_shared_cpi(void) {
+    return 0;
+}
+
+class SplitPointing : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        shared_reports.clear();
+        // An idle slave matrix, so the transactions get as far as the pointing device
+        mock_slave_memory.smatrix.checksum = crc8(mock_slave_memory.smatrix.matrix, sizeof(mock_slave_memory.smatrix.matrix));
+    }
+
+    // Publishes a batch of motion the way the slave does
+    static split_slave_pointing_data_t make_batch(uint8_t sequence, int8_t x) {
+        split_slave_pointing_data_t batch;
+        memset(&batch, 0, sizeof(batch));
+        batch.sequence = sequence;
+        batch.report.x = x;
+        return batch;
+    }
+
+    static void publish(const split_slave_pointing_data_t &batch) {
+        mock_slave_memory.pointing.data           = batch;
+        mock_slave_memory.pointing.check.checksum = crc8(&batch, sizeof(batch));
+        mock_slave_memory.pointing.check.sequence = batch.sequence;
+    }
+
+    static void run_master(void) {
+        matrix_row_t master_matrix[MATRIX_ROWS] = {0};
+        matrix_row_t slave_matrix[MATRIX_ROWS]  = {0};
+        EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    }
+};
+
+TEST_F(SplitPointing, BatchesWithTheSameChecksumAreBothUsed) {
+    split_slave_pointing_data_t first = make_batch(1, 10);
+
+    // Find a following batch whose checksum collides with the first
+    split_slave_pointing_data_t second = make_batch(2, 0);
+    for (int x = 1; x <= 127; x++) {
+        second = make_batch(2, x);
+        if (crc8(&second, sizeof(second)) == crc8(&first, sizeof(first))) {
+            break;
+        }
+    }
+    ASSERT_EQ(crc8(&second, sizeof(second)), crc8(&first, sizeof(first)));
+
+    publish(first);
+    run_master();
+    ASSERT_EQ(shared_reports.size(), 1u);
+    EXPECT_EQ(shared_reports.back().x, first.report.x);
+    EXPECT_EQ(mock_slave_memory.pointing.ack, first.sequence);
+
+    // Well within FORCED_SYNC_THROTTLE_MS, so only the sequence tells the batches apart
+    publish(second);
+    run_master();
+    ASSERT_EQ(shared_reports.size(), 2u);
+    EXPECT_EQ(shared_reports.back().x, second.report.x);
+    EXPECT_EQ(mock_slave_memory.pointing.ack, second.sequence);
+
+    // A batch already used is neither fetched nor used again
+    uint32_t fetched = mock_transaction_count[GET_POINTING_DATA];
+    run_master();
+    EXPECT_EQ(mock_transaction_count[GET_POINTING_DATA], fetched);
+    ASSERT_EQ(shared_reports.size(), 3u);
+    EXPECT_EQ(shared_reports.back().x, 0);
+}
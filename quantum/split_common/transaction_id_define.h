@@ -85,6 +85,7 @@ enum serial_transaction_id {
     GET_POINTING_CHECKSUM,
     GET_POINTING_DATA,
     PUT_POINTING_CPI,
+    PUT_POINTING_ACK,
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
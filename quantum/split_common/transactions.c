@@ -712,19 +712,52 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update     = 0;
-    static uint32_t last_cpi_update = 0;
-    static uint16_t last_cpi        = 0;
-    report_mouse_t  temp_state;
-    uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+    static uint32_t              last_update     = 0;
+    static uint32_t              last_ack_update = 0;
+    static uint32_t              last_cpi_update = 0;
+    static uint16_t              last_cpi        = 0;
+    static uint8_t               last_sequence   = 0; // of the last batch of motion added to the shared report
+    static uint8_t               last_ack        = 0;
+    split_slave_pointing_check_t check;
+    split_slave_pointing_data_t  temp_state;
+    uint16_t                     temp_cpi;
+    bool                         okay = transport_read(GET_POINTING_CHECKSUM, &check, sizeof(check));
+    // A new batch is fetched even when its checksum matches the last one
+    if (okay && (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS || check.sequence != split_shmem->pointing.data.sequence || check.checksum != crc8(&split_shmem->pointing.data, sizeof(temp_state)))) {
+        okay &= transport_read(GET_POINTING_DATA, &temp_state, sizeof(temp_state));
+        okay &= check.sequence == temp_state.sequence && check.checksum == crc8(&temp_state, sizeof(temp_state));
+        if (okay) {
+            last_update = timer_read32();
+        }
+    } else {
+        memcpy(&temp_state, &split_shmem->pointing.data, sizeof(temp_state));
+    }
+    if (okay) {
+        if (temp_state.sequence == last_sequence) {
+            // Motion already used, only the buttons may have changed
+            temp_state.report.x = 0;
+            temp_state.report.y = 0;
+            temp_state.report.h = 0;
+            temp_state.report.v = 0;
+        }
+        if (pointing_device_add_shared_report(temp_state.report)) {
+            last_sequence = temp_state.sequence;
+        }
+    }
+    // The slave keeps its motion until acknowledged, so a failed transfer only delays it
+    split_shmem->pointing.ack = last_sequence;
+    if (send_if_condition(PUT_POINTING_ACK, &last_ack_update, last_ack != last_sequence, &split_shmem->pointing.ack, sizeof(split_shmem->pointing.ack))) {
+        last_ack = last_sequence;
+    } else {
+        okay = false;
+    }
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
-        okay                      = send_if_condition(PUT_POINTING_CPI, &last_cpi_update, last_cpi != temp_cpi, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
-        if (okay) {
+        if (send_if_condition(PUT_POINTING_CPI, &last_cpi_update, last_cpi != temp_cpi, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi))) {
             last_cpi = temp_cpi;
+        } else {
+            okay = false;
         }
     }
     return okay;
@@ -732,6 +765,14 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
 
 extern const pointing_device_driver_t *pointing_device_driver;
 
+// Motion read from the sensor which the master has not acknowledged yet
+static struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+} pointing_pending = {0};
+
 static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #    if defined(POINTING_DEVICE_LEFT)
     if (!is_keyboard_left()) {
@@ -750,29 +791,58 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     last_exec = timer_read32();
 #    endif
 
-    uint16_t temp_cpi = !pointing_device_driver->get_cpi ? 0 : pointing_device_driver->get_cpi(); // check for NULL
-
     split_shared_memory_lock();
     split_slave_pointing_sync_t pointing;
     memcpy(&pointing, &split_shmem->pointing, sizeof(split_slave_pointing_sync_t));
     split_shared_memory_unlock();
 
+    pointing_device_lock();
+    uint16_t temp_cpi = !pointing_device_driver->get_cpi ? 0 : pointing_device_driver->get_cpi(); // check for NULL
     if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver->set_cpi) {
         pointing_device_driver->set_cpi(pointing.cpi);
     }
-
-    pointing.report = pointing_device_driver->get_report((report_mouse_t){0});
+    pointing_device_unlock();
+
+#    ifdef POINTING_DEVICE_SAMPLER_ENABLE
+#        ifndef POINTING_DEVICE_SAMPLER_THREAD
+    pointing_device_sample();
+#        endif
+    report_mouse_t report = pointing_device_sampler_consume((report_mouse_t){0});
+#    else
+    report_mouse_t report = pointing_device_driver->get_report((report_mouse_t){0});
+#    endif
+    pointing_pending.x += report.x;
+    pointing_pending.y += report.y;
+    pointing_pending.h += report.h;
+    pointing_pending.v += report.v;
+
+    // Once the master has used the last batch, the next one takes as much of the pending motion as fits a report
+    if (pointing.ack == pointing.data.sequence && (pointing_pending.x || pointing_pending.y || pointing_pending.h || pointing_pending.v)) {
+        pointing.data.sequence++;
+        pointing.data.report.x = CONSTRAIN_HID_XY(pointing_pending.x);
+        pointing.data.report.y = CONSTRAIN_HID_XY(pointing_pending.y);
+        pointing.data.report.h = pointing_pending.h < MOUSE_REPORT_HV_MIN ? MOUSE_REPORT_HV_MIN : (pointing_pending.h > MOUSE_REPORT_HV_MAX ? MOUSE_REPORT_HV_MAX : pointing_pending.h);
+        pointing.data.report.v = pointing_pending.v < MOUSE_REPORT_HV_MIN ? MOUSE_REPORT_HV_MIN : (pointing_pending.v > MOUSE_REPORT_HV_MAX ? MOUSE_REPORT_HV_MAX : pointing_pending.v);
+        pointing_pending.x -= pointing.data.report.x;
+        pointing_pending.y -= pointing.data.report.y;
+        pointing_pending.h -= pointing.data.report.h;
+        pointing_pending.v -= pointing.data.report.v;
+    }
+    pointing.data.report.buttons = report.buttons;
     // Now update the checksum given that the pointing has been written to
-    pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
+    pointing.check.checksum = crc8(&pointing.data, sizeof(split_slave_pointing_data_t));
+    pointing.check.sequence = pointing.data.sequence;
 
+    // Only what the slave owns is written back, the master may have acknowledged in the meantime
     split_shared_memory_lock();
-    memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
+    split_shmem->pointing.data  = pointing.data;
+    split_shmem->pointing.check = pointing.check;
     split_shared_memory_unlock();
 }
 
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.check), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.data), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi), [PUT_POINTING_ACK] = trans_initiator2target_initializer(pointing.ack),
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -108,10 +108,21 @@ typedef struct _split_mods_sync_t {
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
+typedef struct _split_slave_pointing_data_t {
+    uint8_t        sequence; // changes with every batch of motion
+    report_mouse_t report;   // motion of the batch, and the current buttons
+} split_slave_pointing_data_t;
+
+typedef struct _split_slave_pointing_check_t {
+    uint8_t checksum;
+    uint8_t sequence; // compared as well, as two batches may share a checksum
+} split_slave_pointing_check_t;
+
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    split_slave_pointing_check_t check;
+    split_slave_pointing_data_t  data;
+    uint16_t                    cpi;
+    uint8_t                     ack; // sequence of the last batch the master used
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
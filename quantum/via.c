@@ -45,6 +45,10 @@
 #    include "audio.h"
 #endif
 
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+#    include "pointing_device.h"
+#endif
+
 #if defined(BACKLIGHT_ENABLE)
 #    include "backlight.h"
 #endif
@@ -232,6 +236,7 @@ __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t le
 //      id_qmk_rgb_matrix_channel   ->  via_qmk_rgb_matrix_command()
 //      id_qmk_led_matrix_channel   ->  via_qmk_led_matrix_command()
 //      id_qmk_audio_channel        ->  via_qmk_audio_command()
+//      id_qmk_pointing_channel     ->  via_qmk_pointing_command()
 //
 __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
@@ -272,6 +277,13 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+    if (*channel_id == id_qmk_pointing_channel) {
+        via_qmk_pointing_command(data, length);
+        return;
+    }
+#endif // POINTING_DEVICE_ACCEL_ENABLE
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
@@ -702,6 +714,19 @@ void via_qmk_rgb_matrix_get_value(uint8_t *data) {
             value_data[1] = rgb_matrix_get_sat();
             break;
         }
+#    ifdef RGB_MATRIX_RENDER_BUDGET_US
+        case id_qmk_rgb_matrix_render_stats: {
+            rgb_matrix_render_stats_t stats;
+            rgb_matrix_get_render_stats(&stats);
+            value_data[0] = stats.fps >> 8;
+            value_data[1] = stats.fps & 0xFF;
+            value_data[2] = stats.ns_per_led >> 8;
+            value_data[3] = stats.ns_per_led & 0xFF;
+            value_data[4] = stats.chunk_size;
+            value_data[5] = stats.effect;
+            break;
+        }
+#    endif // RGB_MATRIX_RENDER_BUDGET_US
     }
 }
 
@@ -885,3 +910,87 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+
+void via_qmk_pointing_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_pointing_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_pointing_get_value(value_id_and_data);
+            break;
+        }
+        case id_custom_save: {
+            via_qmk_pointing_save();
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_pointing_get_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t                       *value_id   = &(data[0]);
+    uint8_t                       *value_data = &(data[1]);
+    pointing_device_accel_config_t config     = pointing_device_accel_get_config();
+    switch (*value_id) {
+        case id_qmk_pointing_accel_curve: {
+            value_data[0] = config.curve;
+            break;
+        }
+        case id_qmk_pointing_accel_gain: {
+            value_data[0] = config.gain;
+            break;
+        }
+        case id_qmk_pointing_accel_offset: {
+            value_data[0] = config.offset;
+            break;
+        }
+        case id_qmk_pointing_accel_limit: {
+            value_data[0] = config.limit;
+            break;
+        }
+    }
+}
+
+void via_qmk_pointing_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t                       *value_id   = &(data[0]);
+    uint8_t                       *value_data = &(data[1]);
+    pointing_device_accel_config_t config     = pointing_device_accel_get_config();
+    switch (*value_id) {
+        case id_qmk_pointing_accel_curve: {
+            config.curve = value_data[0];
+            break;
+        }
+        case id_qmk_pointing_accel_gain: {
+            config.gain = value_data[0];
+            break;
+        }
+        case id_qmk_pointing_accel_offset: {
+            config.offset = value_data[0];
+            break;
+        }
+        case id_qmk_pointing_accel_limit: {
+            config.limit = value_data[0];
+            break;
+        }
+    }
+    pointing_device_accel_set_config_noeeprom(config);
+}
+
+void via_qmk_pointing_save(void) {
+    pointing_device_accel_set_config(pointing_device_accel_get_config());
+}
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
@@ -91,6 +91,7 @@ enum via_channel_id {
     id_qmk_rgb_matrix_channel = 3,
     id_qmk_audio_channel      = 4,
     id_qmk_led_matrix_channel = 5,
+    id_qmk_pointing_channel   = 6,
 };
 
 enum via_qmk_backlight_value {
@@ -110,6 +111,7 @@ enum via_qmk_rgb_matrix_value {
     id_qmk_rgb_matrix_effect       = 2,
     id_qmk_rgb_matrix_effect_speed = 3,
     id_qmk_rgb_matrix_color        = 4,
+    id_qmk_rgb_matrix_render_stats = 5,
 };
 
 enum via_qmk_led_matrix_value {
@@ -123,6 +125,13 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+enum via_qmk_pointing_value {
+    id_qmk_pointing_accel_curve  = 1,
+    id_qmk_pointing_accel_gain   = 2,
+    id_qmk_pointing_accel_offset = 3,
+    id_qmk_pointing_accel_limit  = 4,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -188,3 +197,10 @@ void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
 #endif
+
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+void via_qmk_pointing_command(uint8_t *data, uint8_t length);
+void via_qmk_pointing_set_value(uint8_t *data);
+void via_qmk_pointing_get_value(uint8_t *data);
+void via_qmk_pointing_save(void);
+#endif
@@ -0,0 +1,25 @@
+// Copyright 2026 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics` with arguments:
+//    input  | checkerboard.png
+//    format | mono2
+
+// Image's metadata
+// ----------------
+// Width: 8
+// Height: 8
+// Single frame
+
+#include <qp.h>
+
+const uint32_t gfx_checkerboard_length = 56;
+
+// clang-format off
+const uint8_t gfx_checkerboard[56] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x38, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x08, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x08, 0x00, 0x00,
+    0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+};
+// clang-format on
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics` with arguments:
+//    input  | checkerboard.png
+//    format | mono2
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t gfx_checkerboard_length;
+extern const uint8_t  gfx_checkerboard[56];
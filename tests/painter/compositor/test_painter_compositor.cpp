@@ -0,0 +1,156 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+#include "test_painter_device.h"
+}
+
+// Compositors can't be freed, so each test takes a fresh slot out of SURFACE_NUM_COMPOSITORS
+class PainterCompositor : public ::testing::Test {
+   protected:
+    static constexpr uint16_t width  = 32;
+    static constexpr uint16_t height = 32;
+
+    surface_painter_device_t devices[4];
+    uint16_t                 target_buffer[width * height];
+    uint16_t                 bottom_buffer[width * height];
+    uint16_t                 top_buffer[16 * 16];
+
+    painter_device_t     target     = nullptr;
+    painter_device_t     bottom     = nullptr;
+    painter_device_t     top        = nullptr;
+    painter_compositor_t compositor = nullptr;
+
+    void SetUp() override {
+        memset(devices, 0, sizeof(devices));
+        target = qp_make_rgb565_surface_advanced(devices, 4, width, height, target_buffer);
+        bottom = qp_make_rgb565_surface_advanced(devices, 4, width, height, bottom_buffer);
+        top    = qp_make_rgb565_surface_advanced(devices, 4, 16, 16, top_buffer);
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(bottom, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(top, QP_ROTATION_0));
+
+        compositor = qp_make_surface_compositor(width, height);
+        ASSERT_NE(compositor, nullptr);
+    }
+
+    static uint16_t native(uint8_t hue, uint8_t sat, uint8_t val) {
+        qp_pixel_t px = {.dummy = 0};
+        px.hsv888     = (hsv_t){hue, sat, val};
+        rgb565_surface_driver_vtable.base.palette_convert(nullptr, 1, &px);
+        return px.rgb565;
+    }
+
+    uint16_t pixel(uint16_t x, uint16_t y) {
+        return target_buffer[y * width + x];
+    }
+};
+
+TEST_F(PainterCompositor, LaterLayersAreOnTop) {
+    ASSERT_TRUE(qp_rect(bottom, 0, 0, width - 1, height - 1, HSV_RED, true));
+    ASSERT_TRUE(qp_rect(top, 0, 0, 15, 15, HSV_WHITE, true));
+    ASSERT_EQ(qp_compositor_add_layer(compositor, bottom, 0, 0), 0);
+    ASSERT_EQ(qp_compositor_add_layer(compositor, top, 8, 8), 1);
+
+    ASSERT_TRUE(qp_compositor_draw(compositor, target, 0, 0, false));
+    EXPECT_EQ(pixel(0, 0), native(HSV_RED));
+    EXPECT_EQ(pixel(7, 8), native(HSV_RED));
+    EXPECT_EQ(pixel(8, 8), native(HSV_WHITE));
+    EXPECT_EQ(pixel(23, 23), native(HSV_WHITE));
+    EXPECT_EQ(pixel(24, 23), native(HSV_RED));
+}
+
+TEST_F(PainterCompositor, HiddenLayerIsSkipped) {
+    ASSERT_TRUE(qp_rect(bottom, 0, 0, width - 1, height - 1, HSV_RED, true));
+    ASSERT_TRUE(qp_rect(top, 0, 0, 15, 15, HSV_WHITE, true));
+    qp_compositor_add_layer(compositor, bottom, 0, 0);
+    int8_t layer = qp_compositor_add_layer(compositor, top, 0, 0);
+    ASSERT_TRUE(qp_compositor_set_layer_visible(compositor, layer, false));
+
+    ASSERT_TRUE(qp_compositor_draw(compositor, target, 0, 0, false));
+    EXPECT_EQ(pixel(0, 0), native(HSV_RED));
+}
+
+TEST_F(PainterCompositor, AlphaBlendsWithLayerBeneath) {
+    ASSERT_TRUE(qp_rect(bottom, 0, 0, width - 1, height - 1, HSV_BLACK, true));
+    ASSERT_TRUE(qp_rect(top, 0, 0, 15, 15, HSV_WHITE, true));
+    qp_compositor_add_layer(compositor, bottom, 0, 0);
+    int8_t layer = qp_compositor_add_layer(compositor, top, 0, 0);
+    ASSERT_TRUE(qp_compositor_set_layer_alpha(compositor, layer, 128));
+
+    ASSERT_TRUE(qp_compositor_draw(compositor, target, 0, 0, false));
+
+    // White at 50% over black lands on (just under) half of each channel
+    uint16_t px = __builtin_bswap16(pixel(0, 0));
+    EXPECT_EQ((px >> 11) & 0x1F, 15);
+    EXPECT_EQ((px >> 5) & 0x3F, 31);
+    EXPECT_EQ(px & 0x1F, 15);
+    EXPECT_EQ(pixel(16, 16), native(HSV_BLACK));
+}
+
+TEST_F(PainterCompositor, TransparentColorShowsLayerBeneath) {
+    ASSERT_TRUE(qp_rect(bottom, 0, 0, width - 1, height - 1, HSV_RED, true));
+    ASSERT_TRUE(qp_rect(top, 0, 0, 15, 15, HSV_BLACK, true));
+    ASSERT_TRUE(qp_rect(top, 4, 4, 7, 7, HSV_WHITE, true));
+    qp_compositor_add_layer(compositor, bottom, 0, 0);
+    int8_t layer = qp_compositor_add_layer(compositor, top, 0, 0);
+    ASSERT_TRUE(qp_compositor_set_layer_transparent_color(compositor, layer, true, HSV_BLACK));
+
+    ASSERT_TRUE(qp_compositor_draw(compositor, target, 0, 0, false));
+    EXPECT_EQ(pixel(0, 0), native(HSV_RED));
+    EXPECT_EQ(pixel(4, 4), native(HSV_WHITE));
+    EXPECT_EQ(pixel(8, 8), native(HSV_RED));
+}
+
+TEST_F(PainterCompositor, LayersAreClippedToOutput) {
+    ASSERT_TRUE(qp_rect(bottom, 0, 0, width - 1, height - 1, HSV_RED, true));
+    ASSERT_TRUE(qp_rect(top, 0, 0, 15, 15, HSV_WHITE, true));
+    qp_compositor_add_layer(compositor, bottom, 0, 0);
+    int8_t layer = qp_compositor_add_layer(compositor, top, -8, -8);
+
+    ASSERT_TRUE(qp_compositor_draw(compositor, target, 0, 0, false));
+    EXPECT_EQ(pixel(0, 0), native(HSV_WHITE));
+    EXPECT_EQ(pixel(7, 7), native(HSV_WHITE));
+    EXPECT_EQ(pixel(8, 8), native(HSV_RED));
+
+    // Hanging off the far corner only covers what's inside the output
+    ASSERT_TRUE(qp_compositor_set_layer_position(compositor, layer, width - 4, height - 4));
+    ASSERT_TRUE(qp_compositor_draw(compositor, target, 0, 0, false));
+    EXPECT_EQ(pixel(0, 0), native(HSV_RED));
+    EXPECT_EQ(pixel(width - 5, height - 5), native(HSV_RED));
+    EXPECT_EQ(pixel(width - 4, height - 4), native(HSV_WHITE));
+    EXPECT_EQ(pixel(width - 1, height - 1), native(HSV_WHITE));
+}
+
+TEST_F(PainterCompositor, RejectsTargetWithDifferentBitDepth) {
+    qp_compositor_add_layer(compositor, bottom, 0, 0);
+
+    painter_device_t rgb888 = test_painter_make_device(width, height);
+    ASSERT_NE(rgb888, nullptr);
+    EXPECT_FALSE(qp_compositor_draw(compositor, rgb888, 0, 0, true));
+    test_painter_free_device(rgb888);
+}
+
+static bool palette_convert_rgb565_unswapped(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        rgb_t rgb         = hsv_to_rgb_nocie(palette[i].hsv888);
+        palette[i].rgb565 = (((uint16_t)rgb.r) >> 3) << 11 | (((uint16_t)rgb.g) >> 2) << 5 | (((uint16_t)rgb.b) >> 3);
+    }
+    return true;
+}
+
+TEST_F(PainterCompositor, RejectsTargetWithDifferentPixelFormat) {
+    qp_compositor_add_layer(compositor, bottom, 0, 0);
+
+    // Same bit depth, but the target wants its RGB565 in the opposite byte order
+    surface_painter_driver_vtable_t unswapped    = rgb565_surface_driver_vtable;
+    unswapped.base.palette_convert               = palette_convert_rgb565_unswapped;
+    ((painter_driver_t *)target)->driver_vtable = (const painter_driver_vtable_t *)&unswapped;
+    EXPECT_FALSE(qp_compositor_draw(compositor, target, 0, 0, true));
+    ((painter_driver_t *)target)->driver_vtable = (const painter_driver_vtable_t *)&rgb565_surface_driver_vtable;
+}
@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS TRUE
+#define QUANTUM_PAINTER_DISPLAY_TIMEOUT 0
+#define QUANTUM_PAINTER_FLASH_CACHE_BLOCKS 2
+#define QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE 64
+#define QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS 0x1000
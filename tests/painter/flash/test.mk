@@ -0,0 +1,6 @@
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+QUANTUM_PAINTER_EXTERNAL_FLASH_ENABLE = yes
+FLASH_DRIVER = custom
+
+SRC += ../checkerboard.qgf.c
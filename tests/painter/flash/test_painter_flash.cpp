@@ -0,0 +1,171 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qpa.h"
+#include "flash.h"
+#include "test_painter_device.h"
+#include "../checkerboard.qgf.h"
+}
+
+// External flash, erased apart from what the test puts there
+static std::vector<uint8_t> flash_contents(0x2000, 0xFF);
+static uint32_t             flash_reads;
+
+extern "C" void flash_init(void) {}
+
+extern "C" flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    ++flash_reads;
+    for (size_t i = 0; i < len; ++i) {
+        ((uint8_t *)buf)[i] = (addr + i) < flash_contents.size() ? flash_contents[addr + i] : 0xFF;
+    }
+    return FLASH_STATUS_SUCCESS;
+}
+
+class PainterFlash : public ::testing::Test {
+   protected:
+    static constexpr uint32_t table  = QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS;
+    static constexpr uint32_t block  = QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE;
+    static constexpr uint16_t width  = 16;
+    static constexpr uint16_t height = 16;
+
+    void SetUp() override {
+        std::fill(flash_contents.begin(), flash_contents.end(), 0xFF);
+        qp_flash_stream_invalidate_cache();
+        flash_reads = 0;
+    }
+
+    // Writes an asset table the same way as `qmk painter-pack-assets`, returning the offset of each asset
+    std::vector<uint32_t> pack(const std::vector<std::vector<uint8_t>> &assets) {
+        std::vector<uint32_t> offsets;
+        uint32_t              position = sizeof(qpa_table_descriptor_v1_t) + sizeof(qpa_asset_offsets_v1_t) + assets.size() * sizeof(uint32_t);
+        for (auto &asset : assets) {
+            position = (position + 3) & ~3u;
+            offsets.push_back(position);
+            memcpy(&flash_contents[table + position], asset.data(), asset.size());
+            position += asset.size();
+        }
+
+        qpa_table_descriptor_v1_t descriptor = {};
+        descriptor.header.type_id            = QPA_TABLE_DESCRIPTOR_TYPEID;
+        descriptor.header.neg_type_id        = ~QPA_TABLE_DESCRIPTOR_TYPEID;
+        descriptor.header.length             = sizeof(qpa_table_descriptor_v1_t) - sizeof(qgf_block_header_v1_t);
+        descriptor.magic                     = QPA_MAGIC;
+        descriptor.qpa_version               = 0x01;
+        descriptor.total_file_size           = position;
+        descriptor.neg_total_file_size       = ~position;
+        descriptor.asset_count               = assets.size();
+        memcpy(&flash_contents[table], &descriptor, sizeof(descriptor));
+
+        qpa_asset_offsets_v1_t header = {};
+        header.header.type_id         = QPA_ASSET_OFFSET_DESCRIPTOR_TYPEID;
+        header.header.neg_type_id     = ~QPA_ASSET_OFFSET_DESCRIPTOR_TYPEID;
+        header.header.length          = assets.size() * sizeof(uint32_t);
+        memcpy(&flash_contents[table + sizeof(descriptor)], &header, sizeof(header));
+        memcpy(&flash_contents[table + sizeof(descriptor) + sizeof(header)], offsets.data(), offsets.size() * sizeof(uint32_t));
+        return offsets;
+    }
+
+    // Reads length bytes through a flash stream, returning their sum
+    uint32_t read(qp_flash_stream_t &stream, uint32_t position, uint32_t length) {
+        uint32_t sum = 0;
+        qp_stream_setpos(&stream, position);
+        for (uint32_t i = 0; i < length; ++i) {
+            sum += qp_stream_get(&stream);
+        }
+        return sum;
+    }
+};
+
+TEST_F(PainterFlash, AssetTableLookup) {
+    std::vector<uint32_t> offsets = pack({{1, 2, 3}, {4, 5, 6, 7, 8}, {9}});
+
+    for (uint16_t i = 0; i < offsets.size(); ++i) {
+        EXPECT_EQ(qp_flash_asset_address(i), table + offsets[i]);
+        EXPECT_EQ(offsets[i] % 4, 0u);
+    }
+    EXPECT_EQ(flash_contents[qp_flash_asset_address(1)], 4);
+    EXPECT_EQ(qp_flash_asset_address(offsets.size()), QP_FLASH_ASSET_INVALID);
+}
+
+TEST_F(PainterFlash, InvalidTableIsRejected) {
+    pack({{1, 2, 3}});
+    flash_contents[table + sizeof(qgf_block_header_v1_t)] ^= 0xFF; // magic
+    EXPECT_EQ(qp_flash_asset_address(0), QP_FLASH_ASSET_INVALID);
+
+    // Erased flash
+    std::fill(flash_contents.begin(), flash_contents.end(), 0xFF);
+    qp_flash_stream_invalidate_cache();
+    EXPECT_EQ(qp_flash_asset_address(0), QP_FLASH_ASSET_INVALID);
+    EXPECT_EQ(qp_load_image_flash(qp_flash_asset_address(0)), nullptr);
+}
+
+TEST_F(PainterFlash, SequentialReadsFetchWholeBlocks) {
+    for (uint32_t i = 0; i < 3 * block; ++i) {
+        flash_contents[i] = i;
+    }
+    qp_flash_stream_t stream = qp_make_flash_stream(0, 3 * block);
+
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < 3 * block; ++i) {
+        expected += (uint8_t)i;
+    }
+    EXPECT_EQ(read(stream, 0, 3 * block), expected);
+    EXPECT_EQ(flash_reads, 3u);
+
+    // Reads past the end stop at the stream length without touching flash
+    qp_stream_setpos(&stream, 3 * block);
+    EXPECT_EQ(qp_stream_get(&stream), STREAM_EOF);
+    EXPECT_TRUE(qp_stream_eof(&stream));
+    EXPECT_EQ(flash_reads, 3u);
+}
+
+TEST_F(PainterFlash, LeastRecentlyUsedBlockIsEvicted) {
+    qp_flash_stream_t stream = qp_make_flash_stream(0, 4 * block);
+
+    read(stream, 0 * block, 1); // A
+    read(stream, 1 * block, 1); // B
+    EXPECT_EQ(flash_reads, 2u);
+
+    read(stream, 0 * block + 10, 1); // A hits, B is now the least recently used
+    EXPECT_EQ(flash_reads, 2u);
+
+    read(stream, 2 * block, 1); // C evicts B
+    EXPECT_EQ(flash_reads, 3u);
+    read(stream, 0 * block, 1); // A is still cached
+    EXPECT_EQ(flash_reads, 3u);
+    read(stream, 1 * block, 1); // B was evicted
+    EXPECT_EQ(flash_reads, 4u);
+}
+
+TEST_F(PainterFlash, DrawImage) {
+    std::vector<uint32_t> offsets = pack({{1, 2, 3}, std::vector<uint8_t>(gfx_checkerboard, gfx_checkerboard + gfx_checkerboard_length)});
+
+    painter_device_t device = test_painter_make_device(width, height);
+    ASSERT_NE(device, nullptr);
+    ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+    ASSERT_TRUE(qp_rect(device, 0, 0, width - 1, height - 1, HSV_BLACK, true));
+
+    painter_image_handle_t image = qp_load_image_flash(qp_flash_asset_address(1));
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->width, 8);
+    EXPECT_EQ(image->height, 8);
+    EXPECT_TRUE(qp_drawimage(device, 4, 4, image));
+    for (uint16_t y = 0; y < 8; ++y) {
+        for (uint16_t x = 0; x < 8; ++x) {
+            rgb_t px = test_painter_get_pixel(device, 4 + x, 4 + y);
+            EXPECT_EQ(px.r != 0, ((x + y) % 2) == 0) << "at " << x << "," << y;
+        }
+    }
+
+    // The whole table and image fit in the cache
+    EXPECT_LE(flash_reads, 2u);
+
+    EXPECT_TRUE(qp_close_image(image));
+    test_painter_free_device(device);
+}
@@ -0,0 +1,4 @@
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += checkerboard.qgf.c thintel15.qff.c
@@ -0,0 +1,264 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "test_painter_device.h"
+#include "checkerboard.qgf.h"
+
+extern const uint8_t font_thintel15[966];
+}
+
+class Painter : public ::testing::Test {
+   protected:
+    static constexpr uint16_t width  = 64;
+    static constexpr uint16_t height = 48;
+
+    painter_device_t device = nullptr;
+
+    void SetUp() override {
+        device = test_painter_make_device(width, height);
+        ASSERT_NE(device, nullptr);
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+        ASSERT_TRUE(qp_rect(device, 0, 0, width - 1, height - 1, HSV_BLACK, true));
+        test_painter_reset_stats(device);
+    }
+
+    void TearDown() override {
+        if (HasFailure()) {
+            char filename[128];
+            snprintf(filename, sizeof(filename), ".build/test/painter_%s.ppm", ::testing::UnitTest::GetInstance()->current_test_info()->name());
+            test_painter_dump_ppm(device, filename);
+        }
+        test_painter_free_device(device);
+    }
+
+    bool is_lit(uint16_t x, uint16_t y) {
+        rgb_t px = test_painter_get_pixel(device, x, y);
+        return px.r != 0 || px.g != 0 || px.b != 0;
+    }
+
+    uint32_t count_lit(void) {
+        uint32_t count = 0;
+        for (uint16_t y = 0; y < height; ++y) {
+            for (uint16_t x = 0; x < width; ++x) {
+                count += is_lit(x, y) ? 1 : 0;
+            }
+        }
+        return count;
+    }
+};
+
+TEST_F(Painter, FilledRectIsPixelExact) {
+    EXPECT_TRUE(qp_rect(device, 2, 3, 9, 6, HSV_WHITE, true));
+    for (uint16_t y = 0; y < height; ++y) {
+        for (uint16_t x = 0; x < width; ++x) {
+            bool inside = x >= 2 && x <= 9 && y >= 3 && y <= 6;
+            EXPECT_EQ(is_lit(x, y), inside) << "at " << x << "," << y;
+        }
+    }
+
+    rgb_t px = test_painter_get_pixel(device, 5, 5);
+    EXPECT_EQ(px.r, 255);
+    EXPECT_EQ(px.g, 255);
+    EXPECT_EQ(px.b, 255);
+
+    const test_painter_stats_t *stats = test_painter_get_stats(device);
+    EXPECT_EQ(stats->viewport_calls, 1u);
+    EXPECT_EQ(stats->pixels, 8u * 4u);
+}
+
+TEST_F(Painter, OutlineRectLeavesInteriorUntouched) {
+    EXPECT_TRUE(qp_rect(device, 10, 10, 20, 15, HSV_RED, false));
+    EXPECT_TRUE(is_lit(10, 10));
+    EXPECT_TRUE(is_lit(20, 15));
+    EXPECT_TRUE(is_lit(15, 10));
+    EXPECT_TRUE(is_lit(10, 12));
+    EXPECT_FALSE(is_lit(15, 12));
+    EXPECT_EQ(count_lit(), 2u * 11u + 2u * 4u);
+
+    rgb_t px = test_painter_get_pixel(device, 10, 10);
+    EXPECT_EQ(px.r, 255);
+    EXPECT_EQ(px.g, 0);
+    EXPECT_EQ(px.b, 0);
+}
+
+TEST_F(Painter, LineHitsBothEndpoints) {
+    EXPECT_TRUE(qp_line(device, 0, 0, 15, 15, HSV_WHITE));
+    for (uint16_t i = 0; i < 16; ++i) {
+        EXPECT_TRUE(is_lit(i, i)) << "at " << i;
+    }
+    EXPECT_EQ(count_lit(), 16u);
+
+    test_painter_reset_stats(device);
+    EXPECT_TRUE(qp_line(device, 0, 20, 40, 20, HSV_WHITE));
+    EXPECT_EQ(test_painter_get_stats(device)->viewport_calls, 1u);
+    EXPECT_EQ(count_lit(), 16u + 41u);
+}
+
+TEST_F(Painter, CircleIsSymmetric) {
+    EXPECT_TRUE(qp_circle(device, 24, 24, 10, HSV_WHITE, false));
+    EXPECT_TRUE(is_lit(24, 14));
+    EXPECT_TRUE(is_lit(24, 34));
+    EXPECT_TRUE(is_lit(14, 24));
+    EXPECT_TRUE(is_lit(34, 24));
+    EXPECT_FALSE(is_lit(24, 24));
+    for (uint16_t y = 14; y <= 34; ++y) {
+        for (uint16_t x = 14; x <= 34; ++x) {
+            EXPECT_EQ(is_lit(x, y), is_lit(48 - x, y)) << "at " << x << "," << y;
+            EXPECT_EQ(is_lit(x, y), is_lit(x, 48 - y)) << "at " << x << "," << y;
+        }
+    }
+
+    EXPECT_TRUE(qp_circle(device, 24, 24, 4, HSV_WHITE, true));
+    EXPECT_TRUE(is_lit(24, 24));
+    EXPECT_FALSE(is_lit(24, 19));
+}
+
+TEST_F(Painter, ShallowLineIsSentAsRuns) {
+    // 41 pixels across, 5 down -- Bresenham produces one horizontal run per row
+    EXPECT_TRUE(qp_line(device, 0, 0, 40, 4, HSV_WHITE));
+    EXPECT_EQ(count_lit(), 41u);
+    EXPECT_TRUE(is_lit(0, 0));
+    EXPECT_TRUE(is_lit(40, 4));
+    EXPECT_EQ(test_painter_get_stats(device)->viewport_calls, 5u);
+    EXPECT_EQ(test_painter_get_stats(device)->pixels, 41u);
+}
+
+TEST_F(Painter, CircleIsSentAsSpans) {
+    EXPECT_TRUE(qp_circle(device, 24, 24, 20, HSV_WHITE, false));
+    const test_painter_stats_t *stats = test_painter_get_stats(device);
+    // Far fewer viewports than pixels, as consecutive pixels on each octant are merged
+    EXPECT_LT(stats->viewport_calls * 2, count_lit());
+
+    test_painter_reset_stats(device);
+    EXPECT_TRUE(qp_circle(device, 24, 24, 20, HSV_WHITE, true));
+    // Every row of a filled circle is sent exactly once
+    EXPECT_EQ(test_painter_get_stats(device)->viewport_calls, 41u);
+    for (uint16_t y = 4; y <= 44; ++y) {
+        EXPECT_TRUE(is_lit(24, y)) << "at " << y;
+    }
+}
+
+TEST_F(Painter, EllipseMatchesBounds) {
+    EXPECT_TRUE(qp_ellipse(device, 32, 24, 20, 10, HSV_WHITE, false));
+    EXPECT_TRUE(is_lit(12, 24));
+    EXPECT_TRUE(is_lit(52, 24));
+    EXPECT_TRUE(is_lit(32, 14));
+    EXPECT_TRUE(is_lit(32, 34));
+    EXPECT_FALSE(is_lit(32, 24));
+    EXPECT_FALSE(is_lit(11, 24));
+    EXPECT_FALSE(is_lit(32, 13));
+    for (uint16_t y = 14; y <= 34; ++y) {
+        for (uint16_t x = 12; x <= 52; ++x) {
+            EXPECT_EQ(is_lit(x, y), is_lit(64 - x, y)) << "at " << x << "," << y;
+            EXPECT_EQ(is_lit(x, y), is_lit(x, 48 - y)) << "at " << x << "," << y;
+        }
+    }
+
+    EXPECT_TRUE(qp_ellipse(device, 32, 24, 20, 10, HSV_WHITE, true));
+    for (uint16_t x = 12; x <= 52; ++x) {
+        EXPECT_TRUE(is_lit(x, 24)) << "at " << x;
+    }
+    EXPECT_FALSE(is_lit(11, 24));
+    EXPECT_FALSE(is_lit(53, 24));
+}
+
+TEST_F(Painter, DrawImage) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_checkerboard);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->width, 8);
+    EXPECT_EQ(image->height, 8);
+
+    EXPECT_TRUE(qp_drawimage(device, 4, 4, image));
+    for (uint16_t y = 0; y < 8; ++y) {
+        for (uint16_t x = 0; x < 8; ++x) {
+            EXPECT_EQ(is_lit(4 + x, 4 + y), ((x + y) % 2) == 0) << "at " << x << "," << y;
+        }
+    }
+    EXPECT_EQ(test_painter_get_stats(device)->viewport_calls, 1u);
+    EXPECT_EQ(test_painter_get_stats(device)->pixels, 64u);
+
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(Painter, DrawText) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+
+    int16_t text_width = qp_textwidth(font, "QMK");
+    EXPECT_GT(text_width, 0);
+    EXPECT_EQ(qp_drawtext(device, 0, 0, font, "QMK"), text_width);
+
+    uint32_t lit = count_lit();
+    EXPECT_GT(lit, 0u);
+    for (uint16_t y = 0; y < height; ++y) {
+        for (uint16_t x = 0; x < width; ++x) {
+            if (x >= text_width || y >= font->line_height) {
+                EXPECT_FALSE(is_lit(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+// Throughput of the common drawing primitives against the headless device. Timings are informational only; the
+// transfer counters are what regressions should be judged against, as they are deterministic across hosts.
+TEST_F(Painter, Benchmark) {
+    constexpr int iterations = 1000;
+
+    painter_image_handle_t image = qp_load_image_mem(gfx_checkerboard);
+    painter_font_handle_t  font  = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(image, nullptr);
+    ASSERT_NE(font, nullptr);
+
+    // Timings are printed for reference only; the per-op transfer counts are deterministic, so those are what's asserted
+    auto run = [&](const char *name, auto &&op) {
+        test_painter_reset_stats(device);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            op(i);
+        }
+        auto                       elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        const test_painter_stats_t stats   = *test_painter_get_stats(device);
+        printf("[ BENCH    ] %-10s %8.2f us/op %6u viewports %6u transfers %8u bytes/op\n", name, elapsed / iterations, (unsigned)(stats.viewport_calls / iterations), (unsigned)(stats.pixdata_calls / iterations), (unsigned)(stats.bytes / iterations));
+        return stats;
+    };
+
+    // A filled rect is a single viewport, streamed in pixdata buffer sized chunks
+    test_painter_stats_t stats = run("rect", [&](int i) { qp_rect(device, 0, 0, width - 1, height - 1, i & 1 ? HSV_WHITE : HSV_BLACK, true); });
+    EXPECT_EQ(stats.viewport_calls, iterations);
+    EXPECT_EQ(stats.bytes, (uint32_t)iterations * width * height * sizeof(rgb_t));
+    constexpr uint32_t pixels_per_transfer = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / 24;
+    EXPECT_LE(stats.pixdata_calls, (uint32_t)iterations * ((width * height + pixels_per_transfer - 1) / pixels_per_transfer));
+
+    // Lines, circles and ellipses are drawn as runs, so never need more than one transfer per row or column
+    stats = run("line", [&](int i) { qp_line(device, 0, i % height, width - 1, height - 1 - (i % height), HSV_WHITE); });
+    EXPECT_LE(stats.viewport_calls, (uint32_t)iterations * height);
+    EXPECT_LE(stats.pixdata_calls, (uint32_t)iterations * height);
+    stats = run("circle", [&](int i) { qp_circle(device, width / 2, height / 2, 1 + (i % (height / 2 - 1)), HSV_WHITE, false); });
+    EXPECT_LE(stats.viewport_calls, (uint32_t)iterations * height);
+    EXPECT_LE(stats.pixdata_calls, (uint32_t)iterations * height);
+    stats = run("ellipse", [&](int i) { qp_ellipse(device, width / 2, height / 2, width / 2 - 1, 1 + (i % (height / 2 - 1)), HSV_WHITE, false); });
+    EXPECT_LE(stats.viewport_calls, (uint32_t)iterations * height);
+    EXPECT_LE(stats.pixdata_calls, (uint32_t)iterations * height);
+
+    // An 8x8 image fits in a single transfer
+    stats = run("drawimage", [&](int i) { qp_drawimage(device, i % (width - 8), i % (height - 8), image); });
+    EXPECT_EQ(stats.viewport_calls, iterations);
+    EXPECT_EQ(stats.pixdata_calls, iterations);
+    EXPECT_EQ(stats.bytes, (uint32_t)iterations * 8 * 8 * sizeof(rgb_t));
+
+    // Text needs at most one viewport per glyph
+    stats = run("drawtext", [&](int i) { qp_drawtext(device, 0, 0, font, "QMK"); });
+    EXPECT_LE(stats.viewport_calls, (uint32_t)iterations * 3);
+    EXPECT_LE(stats.pixdata_calls, (uint32_t)iterations * 3);
+
+    qp_close_image(image);
+    qp_close_font(font);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_ACCEL_ENABLE
+// Set by quantum/pointing_device/post_config.h in keyboard builds
+#define POINTING_DEVICE_SUBPIXEL_ENABLE
+#define POINTING_DEVICE_ACCEL_CURVE_DEFAULT POINTING_DEVICE_ACCEL_LINEAR
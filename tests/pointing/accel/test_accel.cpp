@@ -0,0 +1,115 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::Invoke;
+
+class PointingAccel : public TestFixture {
+   protected:
+    void SetUp() override {
+        eeconfig_update_pointing_device_accel_default();
+        pointing_device_subpixel_clear();
+    }
+
+    // Total motion reported while the sensor moves the given counts every millisecond
+    int32_t track(TestDriver &driver, int8_t x, uint16_t scans) {
+        int32_t sum = 0;
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([&sum](report_mouse_t &report) { sum += report.x; }));
+        // Speed is measured from the previous report, start from a known one
+        run_one_scan_loop();
+        pd_set_x(x);
+        for (uint16_t i = 0; i < scans; i++) {
+            run_one_scan_loop();
+        }
+        pd_clear_movement();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+        return sum;
+    }
+};
+
+TEST_F(PointingAccel, CurvesRiseFromOneToFullGain) {
+    pointing_device_accel_config_t config = pointing_device_accel_get_config();
+    pd_fixed_t                     full   = PD_FIXED_ONE + PD_FIXED_RATIO(config.gain, 16);
+
+    for (uint8_t curve = POINTING_DEVICE_ACCEL_LINEAR; curve < POINTING_DEVICE_ACCEL_CURVE_COUNT; curve++) {
+        config.curve = curve;
+        pointing_device_accel_set_config_noeeprom(config);
+
+        EXPECT_EQ(pointing_device_accel_gain(0), PD_FIXED_ONE) << "curve " << (int)curve;
+        EXPECT_EQ(pointing_device_accel_gain(PD_FIXED_FROM_INT(config.offset)), PD_FIXED_ONE) << "curve " << (int)curve;
+        EXPECT_LE(std::abs(pointing_device_accel_gain(PD_FIXED_FROM_INT(config.limit)) - full), 2) << "curve " << (int)curve;
+        EXPECT_LE(std::abs(pointing_device_accel_gain(PD_FIXED_FROM_INT(1000)) - full), 2) << "curve " << (int)curve;
+
+        pd_fixed_t previous = PD_FIXED_ONE;
+        for (pd_fixed_t speed = 0; speed < PD_FIXED_FROM_INT(config.limit + 2); speed += PD_FIXED_ONE / 8) {
+            pd_fixed_t gain = pointing_device_accel_gain(speed);
+            EXPECT_GE(gain, previous) << "curve " << (int)curve << " speed " << speed;
+            previous = gain;
+        }
+    }
+}
+
+TEST_F(PointingAccel, CurvesHaveTheirShape) {
+    pointing_device_accel_config_t config = pointing_device_accel_get_config();
+    pd_fixed_t                     middle = PD_FIXED_FROM_INT(config.offset + config.limit) / 2;
+    pd_fixed_t                     half   = PD_FIXED_ONE + PD_FIXED_RATIO(config.gain, 32);
+
+    config.curve = POINTING_DEVICE_ACCEL_LINEAR;
+    pointing_device_accel_set_config_noeeprom(config);
+    EXPECT_LE(std::abs(pointing_device_accel_gain(middle) - half), 2);
+
+    // Power starts slowly, natural quickly
+    config.curve = POINTING_DEVICE_ACCEL_POWER;
+    pointing_device_accel_set_config_noeeprom(config);
+    EXPECT_LT(pointing_device_accel_gain(middle), half);
+    config.curve = POINTING_DEVICE_ACCEL_NATURAL;
+    pointing_device_accel_set_config_noeeprom(config);
+    EXPECT_GT(pointing_device_accel_gain(middle), half);
+    config.curve = POINTING_DEVICE_ACCEL_SIGMOID;
+    pointing_device_accel_set_config_noeeprom(config);
+    EXPECT_LE(std::abs(pointing_device_accel_gain(middle) - half), 2);
+}
+
+TEST_F(PointingAccel, SlowMotionIsUnchanged) {
+    TestDriver driver;
+
+    EXPECT_EQ(track(driver, POINTING_DEVICE_ACCEL_OFFSET_DEFAULT, 100), 100 * POINTING_DEVICE_ACCEL_OFFSET_DEFAULT);
+}
+
+TEST_F(PointingAccel, FastMotionIsAccelerated) {
+    TestDriver driver;
+
+    int32_t fast = track(driver, POINTING_DEVICE_ACCEL_LIMIT_DEFAULT, 100);
+    EXPECT_NEAR(fast, 100 * POINTING_DEVICE_ACCEL_LIMIT_DEFAULT * (16 + POINTING_DEVICE_ACCEL_GAIN_DEFAULT) / 16, 1);
+}
+
+TEST_F(PointingAccel, NoCurveDisablesAcceleration) {
+    TestDriver                     driver;
+    pointing_device_accel_config_t config = pointing_device_accel_get_config();
+
+    config.curve = POINTING_DEVICE_ACCEL_NONE;
+    pointing_device_accel_set_config_noeeprom(config);
+    EXPECT_EQ(track(driver, 50, 10), 500);
+}
+
+TEST_F(PointingAccel, SettingsArePersisted) {
+    pointing_device_accel_config_t config = {.curve = POINTING_DEVICE_ACCEL_SIGMOID, .gain = 48, .offset = 3, .limit = 20};
+    pointing_device_accel_set_config(config);
+
+    pointing_device_accel_set_config_noeeprom((pointing_device_accel_config_t){0});
+    pointing_device_accel_init();
+    EXPECT_EQ(pointing_device_accel_get_config().raw, config.raw);
+
+    // An unknown curve in EEPROM is replaced by the defaults
+    pointing_device_accel_config_t corrupt = {.raw = 0xFFFFFFFF};
+    eeconfig_update_pointing_device_accel(&corrupt);
+    pointing_device_accel_init();
+    EXPECT_EQ(pointing_device_accel_get_config().curve, POINTING_DEVICE_ACCEL_CURVE_DEFAULT);
+    EXPECT_EQ(pointing_device_accel_get_config().gain, POINTING_DEVICE_ACCEL_GAIN_DEFAULT);
+}
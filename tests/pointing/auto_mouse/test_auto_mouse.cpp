@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::AnyNumber;
+
+class AutoMouse : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber());
+        set_auto_mouse_enable(true);
+        idle_for(AUTO_MOUSE_DELAY + 1);
+    }
+
+    void TearDown() override {
+        set_auto_mouse_enable(false);
+    }
+
+    // Moves the sensor by x counts every interval milliseconds
+    void move(int16_t x, uint16_t interval, uint16_t scans) {
+        for (uint16_t i = 0; i < scans; i++) {
+            if (i % interval == 0) {
+                pd_set_x(x);
+            } else {
+                pd_clear_movement();
+            }
+            run_one_scan_loop();
+        }
+        pd_clear_movement();
+    }
+};
+
+TEST_F(AutoMouse, MotionActivates) {
+    move(2, 1, 20);
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+
+    // The filtered motion takes a few windows to drain away
+    idle_for(AUTO_MOUSE_TIME);
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    idle_for(AUTO_MOUSE_WINDOW_MS * 3);
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+}
+
+TEST_F(AutoMouse, DriftDoesNotActivate) {
+    // One count every 50ms adds up to far more than the threshold, but never within the window
+    move(1, 50, 2000);
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+
+    // Neither does jitter back and forth
+    for (uint16_t i = 0; i < 500; i++) {
+        pd_set_x(i % 2 ? 3 : -3);
+        run_one_scan_loop();
+    }
+    pd_clear_movement();
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    EXPECT_LE(get_auto_mouse_motion(), 1);
+}
+
+TEST_F(AutoMouse, SlowMotionHoldsTheLayer) {
+    // Between the hold threshold and the threshold
+    move(2, 20, 1000);
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+
+    move(2, 1, 20);
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    move(2, 20, AUTO_MOUSE_TIME * 3);
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+}
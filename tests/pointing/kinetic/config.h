@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_KINETIC_ENABLE
+// Set by quantum/pointing_device/post_config.h in keyboard builds
+#define POINTING_DEVICE_SUBPIXEL_ENABLE
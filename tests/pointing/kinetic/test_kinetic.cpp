@@ -0,0 +1,169 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::Invoke;
+
+class PointingKinetic : public TestFixture {
+   protected:
+    int32_t sum_x = 0;
+    int32_t sum_v = 0;
+
+    void SetUp() override {
+        pointing_device_kinetic_stop();
+        pointing_device_subpixel_clear();
+    }
+
+    void record(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) {
+            sum_x += report.x;
+            sum_v += report.v;
+        }));
+    }
+
+    // Moves the sensor by x and v counts every interval milliseconds, then stops
+    void stroke(int16_t x, int16_t v, uint16_t interval, uint16_t scans) {
+        for (uint16_t i = 0; i < scans; i++) {
+            if (i % interval == 0) {
+                pd_set_x(x);
+                pd_set_v(v);
+            } else {
+                pd_clear_movement();
+            }
+            run_one_scan_loop();
+        }
+        pd_clear_movement();
+    }
+
+    void scans(uint16_t count) {
+        for (uint16_t i = 0; i < count; i++) {
+            run_one_scan_loop();
+        }
+    }
+
+    // Glide distance after a release at the given speed, detected after the given time
+    static double glide(double speed, uint16_t half_life, uint16_t released_after) {
+        return speed * half_life / M_LN2 * std::exp2(-(double)released_after / half_life);
+    }
+};
+
+TEST_F(PointingKinetic, DecayIsIndependentOfReportRate) {
+    pd_fixed_t speed = PD_FIXED_FROM_INT(10);
+
+    EXPECT_EQ(pointing_device_kinetic_decay(speed, 0, 100), speed);
+    EXPECT_NEAR(pointing_device_kinetic_decay(speed, 100, 100), speed / 2, 2);
+    EXPECT_NEAR(pointing_device_kinetic_decay(speed, 350, 100), PD_FIXED(10 * 0.08838834764831845), 2);
+    EXPECT_EQ(pointing_device_kinetic_decay(speed, 10, 0), 0);
+    EXPECT_EQ(pointing_device_kinetic_decay(speed, 60000, 100), 0);
+
+    pd_fixed_t stepped = speed;
+    for (uint8_t i = 0; i < 40; i++) {
+        stepped = pointing_device_kinetic_decay(stepped, 5, 100);
+    }
+    EXPECT_NEAR(stepped, pointing_device_kinetic_decay(speed, 200, 100), speed / 1000);
+    EXPECT_NEAR(pointing_device_kinetic_decay(-speed, 150, 100), -pointing_device_kinetic_decay(speed, 150, 100), 1);
+}
+
+TEST_F(PointingKinetic, FlickGlides) {
+    TestDriver driver;
+    record(driver);
+
+    stroke(4, 0, 1, 20);
+    EXPECT_EQ(sum_x, 80);
+    sum_x = 0;
+
+    scans(POINTING_DEVICE_KINETIC_RELEASE_MS);
+    EXPECT_TRUE(pointing_device_kinetic_is_gliding());
+    scans(2000);
+    EXPECT_FALSE(pointing_device_kinetic_is_gliding());
+    EXPECT_NEAR(sum_x, glide(4, POINTING_DEVICE_KINETIC_GLIDE_HALF_LIFE_MS, POINTING_DEVICE_KINETIC_RELEASE_MS), 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingKinetic, SlowReleaseStops) {
+    TestDriver driver;
+    record(driver);
+
+    stroke(1, 0, 2, 40);
+    scans(1000);
+    EXPECT_FALSE(pointing_device_kinetic_is_gliding());
+    EXPECT_EQ(sum_x, 20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingKinetic, ScrollKeepsGoing) {
+    TestDriver driver;
+    record(driver);
+
+    stroke(0, 1, 1, 20);
+    EXPECT_EQ(sum_v, 20);
+    sum_v = 0;
+
+    scans(5000);
+    EXPECT_EQ(sum_x, 0);
+    EXPECT_NEAR(sum_v, glide(1, POINTING_DEVICE_KINETIC_SCROLL_HALF_LIFE_MS, POINTING_DEVICE_KINETIC_RELEASE_MS), 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingKinetic, ButtonStopsGlide) {
+    TestDriver driver;
+    record(driver);
+
+    stroke(4, 0, 1, 20);
+    scans(POINTING_DEVICE_KINETIC_RELEASE_MS + 10);
+    EXPECT_TRUE(pointing_device_kinetic_is_gliding());
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    EXPECT_FALSE(pointing_device_kinetic_is_gliding());
+    sum_x = 0;
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    scans(100);
+    EXPECT_EQ(sum_x, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingKinetic, ContactDecidesRelease) {
+    TestDriver driver;
+    record(driver);
+
+    // Resting on the sensor holds the glide back, and resting too long cancels it
+    pointing_device_kinetic_set_contact(true);
+    stroke(4, 0, 1, 20);
+    sum_x = 0;
+    scans(100);
+    EXPECT_FALSE(pointing_device_kinetic_is_gliding());
+    pointing_device_kinetic_set_contact(false);
+    scans(100);
+    EXPECT_EQ(sum_x, 0);
+
+    // Lifting starts gliding right away, touching again stops it
+    pointing_device_kinetic_set_contact(true);
+    stroke(4, 0, 1, 20);
+    pointing_device_kinetic_set_contact(false);
+    run_one_scan_loop();
+    EXPECT_TRUE(pointing_device_kinetic_is_gliding());
+    scans(50);
+    pointing_device_kinetic_set_contact(true);
+    run_one_scan_loop();
+    EXPECT_FALSE(pointing_device_kinetic_is_gliding());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingKinetic, DisabledDoesNotGlide) {
+    TestDriver driver;
+    record(driver);
+
+    pointing_device_kinetic_enable(false);
+    stroke(4, 0, 1, 20);
+    sum_x = 0;
+    scans(500);
+    EXPECT_EQ(sum_x, 0);
+    pointing_device_kinetic_enable(true);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,3 @@
+POINTING_DEVICE_ENABLE = yes
+MOUSEKEY_ENABLE = yes
+POINTING_DEVICE_DRIVER = custom
@@ -0,0 +1,129 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::Invoke;
+
+class MouseReportInterval : public TestFixture {
+   protected:
+    std::vector<report_mouse_t> reports;
+    std::vector<uint32_t>       times;
+
+    void record(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) {
+            reports.push_back(report);
+            times.push_back(timer_read32());
+        }));
+    }
+
+    int32_t sum_x(void) {
+        int32_t sum = 0;
+        for (auto &report : reports) {
+            sum += report.x;
+        }
+        return sum;
+    }
+
+    // Shortest time between two reports with the same buttons
+    uint32_t shortest_gap(void) {
+        uint32_t gap = UINT32_MAX;
+        for (size_t i = 1; i < reports.size(); i++) {
+            if (reports[i].buttons == reports[i - 1].buttons) {
+                gap = std::min(gap, times[i] - times[i - 1]);
+            }
+        }
+        return gap;
+    }
+};
+
+TEST_F(MouseReportInterval, MotionIsMerged) {
+    TestDriver driver;
+    record(driver);
+
+    for (uint16_t i = 0; i < 64; i++) {
+        pd_set_x(2);
+        run_one_scan_loop();
+    }
+    pd_clear_movement();
+    idle_for(MOUSE_REPORT_INTERVAL_MS);
+
+    EXPECT_EQ(sum_x(), 128);
+    EXPECT_LE(reports.size(), 64 / MOUSE_REPORT_INTERVAL_MS + 1);
+    EXPECT_GE(shortest_gap(), MOUSE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MouseReportInterval, ButtonsAreNotDelayed) {
+    TestDriver driver;
+    record(driver);
+
+    pd_set_x(5);
+    run_one_scan_loop();
+    pd_set_x(3);
+    run_one_scan_loop();
+    pd_clear_movement();
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+
+    // The motion before the press is sent without the button, right before the press
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_EQ(reports[0].x, 5);
+    EXPECT_EQ(reports[1].x, 3);
+    EXPECT_EQ(reports[1].buttons, 0);
+    EXPECT_EQ(reports[2].x, 0);
+    EXPECT_EQ(reports[2].buttons, 1);
+    EXPECT_EQ(times[1], times[2]);
+
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 4);
+    EXPECT_EQ(reports[3].buttons, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MouseReportInterval, OverflowIsSentEarly) {
+    TestDriver driver;
+    record(driver);
+
+    pd_set_x(MOUSE_REPORT_XY_MAX);
+    run_one_scan_loop();
+    pd_set_x(MOUSE_REPORT_XY_MAX);
+    run_one_scan_loop();
+    pd_set_x(10);
+    run_one_scan_loop();
+    pd_clear_movement();
+    idle_for(MOUSE_REPORT_INTERVAL_MS);
+
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_EQ(reports[1].x, MOUSE_REPORT_XY_MAX);
+    EXPECT_EQ(reports[2].x, 10);
+    EXPECT_EQ(sum_x(), 2 * MOUSE_REPORT_XY_MAX + 10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MouseReportInterval, MousekeysShareTheInterval) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+    set_keymap({mouse_key});
+    record(driver);
+
+    mouse_key.press();
+    for (uint16_t i = 0; i < 200; i++) {
+        pd_set_x(1);
+        run_one_scan_loop();
+    }
+    pd_clear_movement();
+    mouse_key.release();
+    idle_for(MOUSE_REPORT_INTERVAL_MS + 1);
+
+    EXPECT_GT(sum_x(), 200);
+    EXPECT_LE(reports.size(), 200 / MOUSE_REPORT_INTERVAL_MS + 1);
+    EXPECT_GE(shortest_gap(), MOUSE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+class PointingSampler : public TestFixture {
+   protected:
+    // Stands in for the sensor's motion interrupt firing once a millisecond while the main loop is busy
+    void sensor_interrupts(uint8_t count) {
+        for (uint8_t i = 0; i < count; i++) {
+            advance_time(1);
+            pointing_device_sample();
+        }
+    }
+};
+
+TEST_F(PointingSampler, MotionBetweenReportsIsAccumulated) {
+    TestDriver driver;
+
+    pd_set_x(2);
+    pd_set_y(-1);
+    sensor_interrupts(5);
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (10, -5, 0, 0, 0));
+    run_one_scan_loop();
+
+    pointing_device_sampler_stats_t stats;
+    pointing_device_sampler_get_stats(&stats);
+    EXPECT_EQ(stats.samples, 5);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampler, FullBufferLosesNoMotion) {
+    TestDriver driver;
+
+    pointing_device_sampler_stats_t before, after;
+    pointing_device_sampler_get_stats(&before);
+
+    pd_set_x(3);
+    sensor_interrupts(3 * POINTING_DEVICE_SAMPLER_BUFFER_SIZE);
+    pd_clear_movement();
+
+    pointing_device_sampler_get_stats(&after);
+    EXPECT_GT(after.overruns, before.overruns);
+
+    // Whatever did not fit in the buffer is reported once the main loop has caught up
+    EXPECT_MOUSE_REPORT(driver, (3 * (POINTING_DEVICE_SAMPLER_BUFFER_SIZE - 1), 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (3 * (2 * POINTING_DEVICE_SAMPLER_BUFFER_SIZE + 1), 0, 0, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampler, MotionBeyondReportRangeCarriesOver) {
+    TestDriver driver;
+
+    pd_set_x(100);
+    sensor_interrupts(3);
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, 0, 0, 0, 0)).Times(2);
+    EXPECT_MOUSE_REPORT(driver, (300 - 2 * MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampler, QuickClickIsNotMerged) {
+    TestDriver driver;
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    sensor_interrupts(1);
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    sensor_interrupts(1);
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampler, ReportsSampleInterval) {
+    TestDriver driver;
+
+    pd_set_x(1);
+    sensor_interrupts(4);
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (4, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_set_x(1);
+    sensor_interrupts(3);
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (3, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    pointing_device_sampler_stats_t stats;
+    pointing_device_sampler_get_stats(&stats);
+    EXPECT_EQ(stats.samples, 3);
+    // Three interrupts, plus the millisecond of the scan loop in between
+    EXPECT_EQ(stats.interval, 4);
+    VERIFY_AND_CLEAR(driver);
+}
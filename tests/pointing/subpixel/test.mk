@@ -0,0 +1,3 @@
+POINTING_DEVICE_ENABLE = yes
+MOUSEKEY_ENABLE = no
+POINTING_DEVICE_DRIVER = custom
@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::Invoke;
+
+static pd_fixed_t motion_scale   = PD_FIXED_ONE;
+static bool       drag_scroll    = false;
+static pd_fixed_t scroll_divisor = PD_FIXED_FROM_INT(64);
+
+extern "C" pointing_device_motion_t pointing_device_motion_user(pointing_device_motion_t motion) {
+    motion.x = pd_fixed_mul(motion.x, motion_scale);
+    motion.y = pd_fixed_mul(motion.y, motion_scale);
+    if (drag_scroll) {
+        motion.h = pointing_device_scroll_from_notches(pd_fixed_div(motion.x, scroll_divisor));
+        motion.v = pointing_device_scroll_from_notches(pd_fixed_div(motion.y, scroll_divisor));
+        motion.x = 0;
+        motion.y = 0;
+    }
+    return motion;
+}
+
+class PointingSubpixel : public TestFixture {
+   protected:
+    void SetUp() override {
+        motion_scale = PD_FIXED_ONE;
+        drag_scroll  = false;
+        pointing_device_subpixel_clear();
+    }
+
+    // Adds up every report sent while the sensor reports the given motion, one scan at a time
+    void track(TestDriver &driver, const std::vector<std::pair<int8_t, int8_t>> &motion) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) {
+            sum_x += report.x;
+            sum_y += report.y;
+            sum_h += report.h;
+            sum_v += report.v;
+            reports++;
+        }));
+        for (auto [x, y] : motion) {
+            pd_set_x(x);
+            pd_set_y(y);
+            run_one_scan_loop();
+        }
+        pd_clear_movement();
+    }
+
+    int32_t  sum_x = 0, sum_y = 0, sum_h = 0, sum_v = 0;
+    uint32_t reports = 0;
+};
+
+TEST_F(PointingSubpixel, SlowScaledMotionIsNotLost) {
+    TestDriver driver;
+
+    // A quarter of a count per scan would be truncated to nothing without carrying the fraction over
+    motion_scale = PD_FIXED(0.25);
+    track(driver, std::vector<std::pair<int8_t, int8_t>>(4000, {1, -1}));
+    EXPECT_EQ(sum_x, 1000);
+    EXPECT_EQ(sum_y, -1000);
+    EXPECT_EQ(reports, 1000u);
+}
+
+TEST_F(PointingSubpixel, MotionIsConservedOverLongSequences) {
+    TestDriver driver;
+
+    motion_scale = PD_FIXED_RATIO(7, 10);
+
+    // Deterministic pseudo random motion, in both directions
+    std::vector<std::pair<int8_t, int8_t>> motion;
+    int32_t                                total_x = 0, total_y = 0;
+    uint32_t                               seed    = 12345;
+    for (int i = 0; i < 10000; i++) {
+        seed      = seed * 1103515245 + 12345;
+        int8_t dx = (int8_t)((seed >> 16) % 21) - 10;
+        int8_t dy = (int8_t)((seed >> 8) % 7) - 3;
+        motion.push_back({dx, dy});
+        total_x += dx;
+        total_y += dy;
+    }
+    track(driver, motion);
+
+    // Only the fraction still carried over may be missing
+    int64_t expected_x = (int64_t)total_x * motion_scale / PD_FIXED_ONE;
+    int64_t expected_y = (int64_t)total_y * motion_scale / PD_FIXED_ONE;
+    EXPECT_LE(std::abs(sum_x - expected_x), 1);
+    EXPECT_LE(std::abs(sum_y - expected_y), 1);
+}
+
+TEST_F(PointingSubpixel, AmplifiedMotionCarriesOver) {
+    TestDriver driver;
+
+    motion_scale = PD_FIXED_FROM_INT(2);
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (200 - MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    pd_set_x(100);
+    run_one_scan_loop();
+    pd_clear_movement();
+    run_one_scan_loop();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSubpixel, FlickCarriesOverOneReport) {
+    TestDriver driver;
+
+    // Only one more full report follows, however far past the report range the motion went
+    motion_scale = PD_FIXED_FROM_INT(100);
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, 0, 0, 0, 0)).Times(2);
+    pd_set_x(100);
+    run_one_scan_loop();
+    pd_clear_movement();
+    run_one_scan_loop();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSubpixel, ScrollFromNotchesSaturates) {
+    // Too many notches to convert saturates, rather than wrapping around to the other direction
+    EXPECT_EQ(pointing_device_scroll_from_notches(INT32_MAX), INT32_MAX);
+    EXPECT_EQ(pointing_device_scroll_from_notches(INT32_MIN), INT32_MIN);
+    EXPECT_EQ(pointing_device_scroll_from_notches(PD_FIXED_FROM_INT(2)), PD_FIXED_FROM_INT(2 * pointing_device_get_hires_scroll_resolution()));
+}
+
+TEST_F(PointingSubpixel, DragScrollUsesHighResolution) {
+    TestDriver driver;
+
+    // 1/64 of a notch per count: 120 / 64 hires units per scan, where whole notches would round to nothing
+    drag_scroll = true;
+    track(driver, std::vector<std::pair<int8_t, int8_t>>(640, {0, 1}));
+    EXPECT_EQ(sum_x, 0);
+    EXPECT_EQ(sum_y, 0);
+    EXPECT_EQ(sum_v, 10 * pointing_device_get_hires_scroll_resolution());
+    EXPECT_GT(reports, 600u);
+}
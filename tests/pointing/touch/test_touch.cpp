@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+static std::vector<pointing_device_gesture_t> gestures;
+static bool                                   default_action = true;
+
+extern "C" bool pointing_device_touch_gesture_user(pointing_device_gesture_t gesture) {
+    gestures.push_back(gesture);
+    return default_action;
+}
+
+class PointingTouch : public TestFixture {
+   protected:
+    uint16_t time = 0;
+
+    void SetUp() override {
+        pointing_device_touch_reset();
+        gestures.clear();
+        default_action = true;
+    }
+
+    // Sends a frame with the given fingers, as {x, y} pairs, then moves time on
+    report_mouse_t frame(std::initializer_list<std::pair<uint16_t, uint16_t>> fingers, uint16_t elapsed = 10, report_mouse_t report = {}) {
+        pointing_device_touch_frame_t frame = {.time = time};
+        for (auto &finger : fingers) {
+            frame.contacts[frame.count] = {.id = frame.count, .x = finger.first, .y = finger.second, .pressure = 100};
+            frame.count++;
+        }
+        time += elapsed;
+        return pointing_device_touch_process(&frame, report);
+    }
+};
+
+TEST_F(PointingTouch, TapsClickForOneFrame) {
+    frame({{500, 500}});
+    frame({{505, 502}});
+    report_mouse_t report = frame({});
+    EXPECT_EQ(report.buttons, 1 << POINTING_DEVICE_BUTTON1);
+    report = frame({}, 10, report);
+    EXPECT_EQ(report.buttons, 0);
+
+    frame({{500, 500}, {700, 500}});
+    report = frame({});
+    EXPECT_EQ(report.buttons, 1 << POINTING_DEVICE_BUTTON2);
+
+    // Fingers landing one after the other still tap together
+    frame({{500, 500}});
+    frame({{500, 500}, {700, 500}});
+    frame({{500, 500}, {700, 500}, {600, 700}});
+    frame({{700, 500}, {600, 700}});
+    report = frame({});
+    EXPECT_EQ(report.buttons, 1 << POINTING_DEVICE_BUTTON3);
+
+    EXPECT_EQ(gestures, (std::vector<pointing_device_gesture_t>{POINTING_DEVICE_GESTURE_TAP, POINTING_DEVICE_GESTURE_TWO_FINGER_TAP, POINTING_DEVICE_GESTURE_THREE_FINGER_TAP}));
+}
+
+TEST_F(PointingTouch, LongOrMovingTouchesDoNotTap) {
+    frame({{500, 500}}, POINTING_DEVICE_TOUCH_TAP_TERM + 1);
+    frame({{500, 500}});
+    EXPECT_EQ(frame({}).buttons, 0);
+
+    frame({{500, 500}});
+    frame({{600, 500}});
+    EXPECT_EQ(frame({}).buttons, 0);
+    EXPECT_TRUE(gestures.empty());
+}
+
+TEST_F(PointingTouch, UserCanReplaceTheClick) {
+    default_action = false;
+    frame({{500, 500}});
+    EXPECT_EQ(frame({}).buttons, 0);
+    EXPECT_EQ(gestures, (std::vector<pointing_device_gesture_t>{POINTING_DEVICE_GESTURE_TAP}));
+}
+
+TEST_F(PointingTouch, OneFingerMovesTheCursor) {
+    frame({{500, 500}});
+    report_mouse_t report = frame({{510, 490}});
+    EXPECT_EQ(report.x, 10);
+    EXPECT_EQ(report.y, -10);
+    EXPECT_EQ(report.v, 0);
+
+    // Lifting a second finger does not make the cursor jump to the centroid
+    frame({{510, 490}, {800, 800}});
+    report = frame({{510, 490}});
+    EXPECT_EQ(report.x, 0);
+    EXPECT_EQ(report.y, 0);
+    report = frame({{515, 490}});
+    EXPECT_EQ(report.x, 5);
+}
+
+TEST_F(PointingTouch, TwoFingersScroll) {
+    int32_t v = 0, h = 0;
+
+    frame({{500, 500}, {700, 500}});
+    for (uint16_t y = 510; y <= 900; y += 10) {
+        report_mouse_t report = frame({{500, y}, {700, y}});
+        EXPECT_EQ(report.x, 0);
+        EXPECT_EQ(report.y, 0);
+        v += report.v;
+        h += report.h;
+    }
+    // The first tap distance decides the gesture, the rest scrolls and keeps its remainder
+    EXPECT_EQ(v, (400 - 60) / POINTING_DEVICE_TOUCH_SCROLL_DIVISOR);
+    EXPECT_EQ(h, 0);
+    EXPECT_TRUE(gestures.empty());
+}
+
+TEST_F(PointingTouch, TwoFingersPinch) {
+    frame({{500, 500}, {700, 500}});
+    for (uint16_t spread = 10; spread <= 200; spread += 10) {
+        frame({{(uint16_t)(500 - spread), 500}, {(uint16_t)(700 + spread), 500}});
+    }
+    // The fingers moved apart by 400, each moving 200 from the centroid
+    EXPECT_EQ(gestures, (std::vector<pointing_device_gesture_t>{POINTING_DEVICE_GESTURE_PINCH_OUT, POINTING_DEVICE_GESTURE_PINCH_OUT}));
+
+    gestures.clear();
+    for (uint16_t spread = 190; spread < 200; spread -= 10) {
+        frame({{(uint16_t)(500 - spread), 500}, {(uint16_t)(700 + spread), 500}});
+    }
+    EXPECT_EQ(gestures, (std::vector<pointing_device_gesture_t>{POINTING_DEVICE_GESTURE_PINCH_IN, POINTING_DEVICE_GESTURE_PINCH_IN}));
+}
+
+TEST_F(PointingTouch, ThreeFingersSwipeOnce) {
+    frame({{500, 500}, {600, 500}, {700, 500}});
+    for (uint16_t x = 500; x >= 50; x -= 50) {
+        frame({{x, 500}, {(uint16_t)(x + 100), 500}, {(uint16_t)(x + 200), 500}});
+    }
+    frame({{50, 500}, {150, 500}});
+    frame({});
+    EXPECT_EQ(gestures, (std::vector<pointing_device_gesture_t>{POINTING_DEVICE_GESTURE_SWIPE_LEFT}));
+
+    gestures.clear();
+    frame({{500, 900}, {600, 900}, {700, 900}});
+    frame({{500, 500}, {600, 500}, {700, 500}});
+    frame({});
+    EXPECT_EQ(gestures, (std::vector<pointing_device_gesture_t>{POINTING_DEVICE_GESTURE_SWIPE_UP}));
+}
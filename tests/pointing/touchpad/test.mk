@@ -0,0 +1,4 @@
+POINTING_DEVICE_ENABLE = yes
+MOUSEKEY_ENABLE = no
+POINTING_DEVICE_DRIVER = custom
+DIGITIZER_ENABLE = yes
@@ -0,0 +1,134 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+static std::vector<report_digitizer_t> reports;
+
+extern "C" void send_digitizer(report_digitizer_t *report) {
+    reports.push_back(*report);
+}
+
+class PointingTouchpad : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        pointing_device_touch_set_digitizer(true);
+        scans(DIGITIZER_TOUCHPAD_INTERVAL_MS * 2);
+        reports.clear();
+    }
+
+    // Sends a frame with the given fingers, as {id, x, y}, on a sensor 1000 by 500 units large
+    report_mouse_t frame(std::initializer_list<std::tuple<uint8_t, uint16_t, uint16_t>> fingers) {
+        pointing_device_touch_frame_t frame = {.time = timer_read(), .width = 1000, .height = 500};
+        for (auto &finger : fingers) {
+            frame.contacts[frame.count++] = {.id = std::get<0>(finger), .x = std::get<1>(finger), .y = std::get<2>(finger), .pressure = 100};
+        }
+        return pointing_device_touch_process(&frame, (report_mouse_t){});
+    }
+
+    void scans(uint16_t count) {
+        for (uint16_t i = 0; i < count; i++) {
+            run_one_scan_loop();
+        }
+    }
+};
+
+TEST_F(PointingTouchpad, ContactsAreScaled) {
+    report_mouse_t mouse = frame({{0, 500, 250}, {3, 1000, 0}});
+    EXPECT_EQ(mouse.x, 0);
+    run_one_scan_loop();
+
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0].contact_count, 2);
+    EXPECT_TRUE(reports[0].contacts[0].tip);
+    EXPECT_TRUE(reports[0].contacts[0].confidence);
+    EXPECT_EQ(reports[0].contacts[0].id, 0);
+    EXPECT_EQ(reports[0].contacts[0].x, 0x7FFF / 2);
+    EXPECT_EQ(reports[0].contacts[0].y, 0x7FFF / 2);
+    EXPECT_EQ(reports[0].contacts[1].id, 3);
+    EXPECT_EQ(reports[0].contacts[1].x, 0x7FFF);
+    EXPECT_EQ(reports[0].contacts[1].y, 0);
+}
+
+TEST_F(PointingTouchpad, ChangesAreBatched) {
+    // A frame every millisecond, only the latest goes out once per interval
+    for (uint16_t i = 0; i < DIGITIZER_TOUCHPAD_INTERVAL_MS * 4; i++) {
+        frame({{0, (uint16_t)(100 + i), 100}, {1, 200, 200}});
+        run_one_scan_loop();
+    }
+    ASSERT_EQ(reports.size(), 4);
+    EXPECT_EQ(reports.back().contacts[0].x, (100 + DIGITIZER_TOUCHPAD_INTERVAL_MS * 3) * 0x7FFF / 1000);
+
+    // Fingers resting still send nothing
+    reports.clear();
+    for (uint16_t i = 0; i < 100; i++) {
+        frame({{0, 500, 100}, {1, 200, 200}});
+        run_one_scan_loop();
+    }
+    EXPECT_EQ(reports.size(), 1);
+}
+
+TEST_F(PointingTouchpad, LiftedContactsAreReported) {
+    frame({{0, 100, 100}, {1, 200, 200}});
+    scans(DIGITIZER_TOUCHPAD_INTERVAL_MS);
+    frame({{1, 300, 200}});
+    scans(DIGITIZER_TOUCHPAD_INTERVAL_MS);
+    frame({});
+    scans(DIGITIZER_TOUCHPAD_INTERVAL_MS);
+    scans(100);
+
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_EQ(reports[1].contact_count, 2);
+    EXPECT_EQ(reports[1].contacts[0].id, 0);
+    EXPECT_FALSE(reports[1].contacts[0].tip);
+    EXPECT_EQ(reports[1].contacts[0].x, 100 * 0x7FFF / 1000);
+    EXPECT_EQ(reports[1].contacts[1].id, 1);
+    EXPECT_TRUE(reports[1].contacts[1].tip);
+    EXPECT_EQ(reports[1].contacts[1].x, 300 * 0x7FFF / 1000);
+    EXPECT_EQ(reports[2].contact_count, 1);
+    EXPECT_FALSE(reports[2].contacts[0].tip);
+}
+
+TEST_F(PointingTouchpad, FullReportDefersNewContacts) {
+    frame({{0, 100, 100}, {1, 100, 100}, {2, 100, 100}, {3, 100, 100}, {4, 100, 100}});
+    scans(DIGITIZER_TOUCHPAD_INTERVAL_MS);
+
+    // Every finger lifted and put down again elsewhere within one interval
+    frame({{5, 200, 100}, {6, 200, 100}, {7, 200, 100}, {8, 200, 100}, {9, 200, 100}});
+    scans(DIGITIZER_TOUCHPAD_INTERVAL_MS * 2);
+
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_EQ(reports[1].contact_count, DIGITIZER_TOUCHPAD_CONTACTS);
+    for (uint8_t i = 0; i < DIGITIZER_TOUCHPAD_CONTACTS; i++) {
+        EXPECT_FALSE(reports[1].contacts[i].tip);
+        EXPECT_EQ(reports[1].contacts[i].id, i);
+    }
+    EXPECT_EQ(reports[2].contact_count, DIGITIZER_TOUCHPAD_CONTACTS);
+    for (uint8_t i = 0; i < DIGITIZER_TOUCHPAD_CONTACTS; i++) {
+        EXPECT_TRUE(reports[2].contacts[i].tip);
+        EXPECT_EQ(reports[2].contacts[i].id, i + 5);
+    }
+}
+
+TEST_F(PointingTouchpad, DisablingFallsBackToGestures) {
+    frame({{0, 100, 100}});
+    scans(DIGITIZER_TOUCHPAD_INTERVAL_MS);
+    pointing_device_touch_set_digitizer(false);
+    EXPECT_FALSE(pointing_device_touch_get_digitizer());
+    scans(DIGITIZER_TOUCHPAD_INTERVAL_MS);
+
+    // The finger still down is lifted for the host
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_FALSE(reports[1].contacts[0].tip);
+
+    frame({{0, 100, 100}});
+    report_mouse_t mouse = frame({{0, 110, 95}});
+    EXPECT_EQ(mouse.x, 10);
+    EXPECT_EQ(mouse.y, -5);
+    scans(100);
+    EXPECT_EQ(reports.size(), 2);
+}
@@ -0,0 +1,7 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Same LEDs and effects as the main RGB matrix tests
+#include "../config.h"
@@ -0,0 +1,114 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "../test_rgb_matrix_driver.h"
+
+void advance_time(uint32_t ms);
+
+extern uint16_t rand16seed;
+}
+
+// Frames rendered by the effects as they were before any of the rendering optimisations. After an intentional change
+// to an effect's output, run with RGB_MATRIX_UPDATE_GOLDEN=1 and paste the printed lines into golden_frames.inc
+static const std::map<std::string, std::string> golden = {
+#include "golden_frames.inc"
+};
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+// Some effects keep private state between runs, so the golden frames live in their own test binary where nothing
+// else can have run them first
+class RgbMatrixGolden : public TestFixture {
+   protected:
+    void SetUp() override {
+        TestDriver driver;
+
+        eeconfig_update_rgb_matrix_default();
+        rgb_matrix_init();
+        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_NONE);
+        for (uint8_t ms = 0; ms < 2 * RGB_MATRIX_LED_FLUSH_LIMIT; ++ms) {
+            rgb_matrix_task();
+            advance_time(1);
+        }
+    }
+
+    // Runs the RGB matrix task a millisecond at a time until the requested number of frames have been flushed,
+    // forcing static effects to redraw each frame as well
+    bool run_frames(uint32_t frames) {
+        uint32_t target = test_rgb_matrix_get_flush_count() + frames;
+        for (uint32_t ms = 0; ms < frames * 100; ++ms) {
+            rgb_matrix_invalidate();
+            rgb_matrix_task();
+            if (test_rgb_matrix_get_flush_count() >= target) {
+                return true;
+            }
+            advance_time(1);
+        }
+        return false;
+    }
+
+    // FNV-1a over every LED of the most recently flushed frame
+    static uint32_t hash_frame(uint32_t hash) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
+            rgb_t   led     = test_rgb_matrix_get_led(i);
+            uint8_t bytes[] = {led.r, led.g, led.b};
+            for (uint8_t byte : bytes) {
+                hash = (hash ^ byte) * 16777619u;
+            }
+        }
+        return hash;
+    }
+};
+
+TEST_F(RgbMatrixGolden, EffectsMatchGoldenFrames) {
+    TestDriver         driver;
+    constexpr uint32_t frames = 48;
+
+    bool update = getenv("RGB_MATRIX_UPDATE_GOLDEN") != nullptr;
+
+    rgb_matrix_sethsv_noeeprom(HSV_CYAN);
+    rgb_matrix_set_speed_noeeprom(128);
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; ++mode) {
+        srand(1);
+        rand16seed = 1337;
+        rgb_matrix_mode_noeeprom(mode);
+
+        uint32_t frame_hash = 2166136261u;
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            if (frame % 16 == 0) {
+                // A single key per burst, as several at once saturate the additive reactive effects
+                uint8_t key = frame / 16;
+                rgb_matrix_handle_key_event(key % MATRIX_ROWS, (key * 4 + 1) % MATRIX_COLS, true);
+                rgb_matrix_handle_key_event(key % MATRIX_ROWS, (key * 4 + 1) % MATRIX_COLS, false);
+            }
+            ASSERT_TRUE(run_frames(1)) << effect_names[mode];
+            frame_hash = hash_frame(frame_hash);
+        }
+
+        char actual[9];
+        snprintf(actual, sizeof(actual), "%08x", (unsigned)frame_hash);
+        if (update) {
+            printf("{\"%s\", \"%s\"},\n", effect_names[mode], actual);
+        } else {
+            auto expected = golden.find(effect_names[mode]);
+            ASSERT_NE(expected, golden.end()) << effect_names[mode] << " has no golden frames";
+            EXPECT_EQ(expected->second, actual) << effect_names[mode] << " rendered different frames";
+        }
+    }
+}
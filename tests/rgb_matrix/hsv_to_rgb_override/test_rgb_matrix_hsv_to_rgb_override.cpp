@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "../test_rgb_matrix_driver.h"
+
+void advance_time(uint32_t ms);
+
+// Overrides the weak default, so batched runners must call it for every LED
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    return (rgb_t){.r = 1, .g = 2, .b = 3};
+}
+}
+
+class RgbMatrixHsvToRgbOverride : public TestFixture {
+   protected:
+    // Runs the RGB matrix task a millisecond at a time until the requested number of frames have been flushed
+    bool run_frames(uint32_t frames) {
+        uint32_t target = test_rgb_matrix_get_flush_count() + frames;
+        for (uint32_t ms = 0; ms < frames * 100; ++ms) {
+            rgb_matrix_task();
+            if (test_rgb_matrix_get_flush_count() >= target) {
+                return true;
+            }
+            advance_time(1);
+        }
+        return false;
+    }
+};
+
+TEST_F(RgbMatrixHsvToRgbOverride, BatchedRunnerUsesOverride) {
+    TestDriver driver;
+
+    rgb_matrix_sethsv_noeeprom(HSV_WHITE);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_ALL);
+    ASSERT_TRUE(run_frames(2));
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_t led = test_rgb_matrix_get_led(i);
+        EXPECT_EQ(led.r, 1);
+        EXPECT_EQ(led.g, 2);
+        EXPECT_EQ(led.b, 3);
+    }
+}
@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "../test_rgb_matrix_driver.h"
+
+void advance_time(uint32_t ms);
+}
+
+class RgbMatrixPowerLimit : public TestFixture {
+   protected:
+    // Runs the RGB matrix task a millisecond at a time until the requested number of frames have been flushed
+    bool run_frames(uint32_t frames) {
+        uint32_t target = test_rgb_matrix_get_flush_count() + frames;
+        for (uint32_t ms = 0; ms < frames * 100; ++ms) {
+            rgb_matrix_task();
+            if (test_rgb_matrix_get_flush_count() >= target) {
+                return true;
+            }
+            advance_time(1);
+        }
+        return false;
+    }
+};
+
+TEST_F(RgbMatrixPowerLimit, ScalesBrightFrames) {
+    TestDriver               driver;
+    rgb_matrix_power_stats_t stats;
+
+    rgb_matrix_sethsv_noeeprom(HSV_WHITE);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    ASSERT_TRUE(run_frames(2));
+
+    rgb_matrix_get_power_stats(&stats);
+    uint32_t white = RGB_MATRIX_LED_COUNT * (RGB_MATRIX_POWER_MA_RED + RGB_MATRIX_POWER_MA_GREEN + RGB_MATRIX_POWER_MA_BLUE + RGB_MATRIX_POWER_MA_IDLE);
+    EXPECT_EQ(stats.requested, white);
+    EXPECT_LE(stats.delivered, RGB_MATRIX_POWER_LIMIT);
+    EXPECT_LT(stats.scale, RGB_POWER_SCALE_MAX);
+
+    rgb_t led = test_rgb_matrix_get_led(0);
+    EXPECT_LT(led.r, 255);
+    EXPECT_EQ(led.r, led.g);
+    EXPECT_EQ(led.g, led.b);
+}
+
+TEST_F(RgbMatrixPowerLimit, LeavesFramesWithinBudget) {
+    TestDriver               driver;
+    rgb_matrix_power_stats_t stats;
+
+    rgb_matrix_sethsv_noeeprom(HSV_CYAN);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    ASSERT_TRUE(run_frames(2));
+
+    rgb_matrix_get_power_stats(&stats);
+    EXPECT_EQ(stats.scale, RGB_POWER_SCALE_MAX);
+    EXPECT_EQ(stats.delivered, stats.requested);
+
+    rgb_t led      = test_rgb_matrix_get_led(0);
+    rgb_t expected = hsv_to_rgb((hsv_t){HSV_CYAN});
+    EXPECT_EQ(led.g, expected.g);
+    EXPECT_EQ(led.b, expected.b);
+}
@@ -0,0 +1,5 @@
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+RGB_MATRIX_CUSTOM_KB = yes
+
+SRC += ../test_rgb_matrix_driver.c
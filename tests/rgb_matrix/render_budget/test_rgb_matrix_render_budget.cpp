@@ -0,0 +1,85 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "../test_rgb_matrix_driver.h"
+
+void advance_time(uint32_t ms);
+}
+
+class RgbMatrixRenderBudget : public TestFixture {
+   protected:
+    void SetUp() override {
+        // Render a frame of nothing, so the next effect starts measuring from scratch
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_NONE);
+        run(100);
+    }
+
+    // Runs the RGB matrix task a millisecond at a time
+    void run(uint32_t ms) {
+        for (; ms > 0; --ms) {
+            rgb_matrix_task();
+            advance_time(1);
+        }
+    }
+
+    rgb_matrix_render_stats_t stats(void) {
+        rgb_matrix_render_stats_t stats;
+        rgb_matrix_get_render_stats(&stats);
+        return stats;
+    }
+};
+
+TEST_F(RgbMatrixRenderBudget, StartsFromProcessLimit) {
+    TestDriver driver;
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CUSTOM_HEAVY);
+    run(50);
+    EXPECT_EQ(stats().effect, RGB_MATRIX_CUSTOM_HEAVY);
+    EXPECT_EQ(stats().chunk_size, RGB_MATRIX_LED_PROCESS_LIMIT);
+    EXPECT_EQ(stats().ns_per_led, 0);
+}
+
+TEST_F(RgbMatrixRenderBudget, HeavyEffectFitsBudget) {
+    TestDriver driver;
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CUSTOM_HEAVY);
+    run(3000);
+    // A sample ends part way between ticks, so may be out by up to one tick in RGB_MATRIX_RENDER_SAMPLE_MS
+    EXPECT_NEAR(stats().ns_per_led, 31250, 31250 / RGB_MATRIX_RENDER_SAMPLE_MS);
+    EXPECT_EQ(stats().chunk_size, RGB_MATRIX_RENDER_BUDGET_US * 1000 / 31250);
+}
+
+TEST_F(RgbMatrixRenderBudget, FreeEffectGrowsGradually) {
+    TestDriver driver;
+
+    // No ticks land inside the render of a free effect, which must not be taken as a cost of zero
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    run(1100);
+    EXPECT_GT(stats().ns_per_led, 0);
+    EXPECT_EQ(stats().chunk_size, RGB_MATRIX_LED_PROCESS_LIMIT * 2);
+
+    run(1000);
+    EXPECT_EQ(stats().chunk_size, RGB_MATRIX_LED_PROCESS_LIMIT * 4);
+
+    run(1000);
+    EXPECT_EQ(stats().chunk_size, RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixRenderBudget, FpsCountsFromFirstFrame) {
+    TestDriver driver;
+
+    // Time passing before the effect starts must not count against its first second
+    advance_time(10000);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    run(900);
+    EXPECT_EQ(stats().fps, 0);
+
+    run(200);
+    EXPECT_GE(stats().fps, 1000 / RGB_MATRIX_LED_FLUSH_LIMIT - 10);
+    EXPECT_LE(stats().fps, 1000 / RGB_MATRIX_LED_FLUSH_LIMIT + 1);
+}
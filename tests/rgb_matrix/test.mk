@@ -0,0 +1,4 @@
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+SRC += test_rgb_matrix_driver.c
@@ -0,0 +1,149 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "test_rgb_matrix_driver.h"
+
+void advance_time(uint32_t ms);
+}
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+class RgbMatrix : public TestFixture {
+   protected:
+    // Puts the RGB matrix back to its power-on state, so no test depends on what ran before it
+    void SetUp() override {
+        TestDriver driver;
+
+        eeconfig_update_rgb_matrix_default();
+        rgb_matrix_init();
+        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_NONE);
+        for (uint8_t ms = 0; ms < 2 * RGB_MATRIX_LED_FLUSH_LIMIT; ++ms) {
+            rgb_matrix_task();
+            advance_time(1);
+        }
+    }
+
+    // Runs the RGB matrix task a millisecond at a time until the requested number of frames have been flushed,
+    // forcing static effects to redraw each frame as well
+    bool run_frames(uint32_t frames) {
+        uint32_t target = test_rgb_matrix_get_flush_count() + frames;
+        for (uint32_t ms = 0; ms < frames * 100; ++ms) {
+            rgb_matrix_invalidate();
+            rgb_matrix_task();
+            if (test_rgb_matrix_get_flush_count() >= target) {
+                return true;
+            }
+            advance_time(1);
+        }
+        return false;
+    }
+
+    // Runs the RGB matrix task for a number of milliseconds, returning the number of frames flushed
+    uint32_t count_frames(uint32_t ms) {
+        uint32_t start = test_rgb_matrix_get_flush_count();
+        for (; ms > 0; --ms) {
+            rgb_matrix_task();
+            advance_time(1);
+        }
+        return test_rgb_matrix_get_flush_count() - start;
+    }
+
+    void hit_keys(void) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col += 3) {
+            rgb_matrix_handle_key_event(col % MATRIX_ROWS, col, true);
+            rgb_matrix_handle_key_event(col % MATRIX_ROWS, col, false);
+        }
+    }
+};
+
+TEST_F(RgbMatrix, EveryEffectRendersFrames) {
+    TestDriver driver;
+
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; ++mode) {
+        rgb_matrix_mode_noeeprom(mode);
+        hit_keys();
+        EXPECT_TRUE(run_frames(3)) << effect_names[mode];
+    }
+}
+
+TEST_F(RgbMatrix, PolarEffectsUseLedGeometry) {
+    TestDriver driver;
+
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_PINWHEEL);
+    ASSERT_TRUE(run_frames(2));
+
+    // LEDs mirrored through the center sit half a turn apart on the pinwheel
+    rgb_t left  = test_rgb_matrix_get_led(10);
+    rgb_t right = test_rgb_matrix_get_led(19);
+    EXPECT_FALSE(left.r == right.r && left.g == right.g && left.b == right.b);
+}
+
+TEST_F(RgbMatrix, StaticEffectsStopFlushing) {
+    TestDriver driver;
+
+    rgb_matrix_sethsv_noeeprom(HSV_RED);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    ASSERT_TRUE(run_frames(2));
+    // Let the frame forced by run_frames() finish
+    count_frames(100);
+    EXPECT_EQ(count_frames(500), 0u);
+
+    // Configuration changes redraw the frame once
+    rgb_matrix_sethsv_noeeprom(HSV_BLUE);
+    EXPECT_EQ(count_frames(500), 1u);
+    EXPECT_EQ(test_rgb_matrix_get_led(0).b, hsv_to_rgb((hsv_t){HSV_BLUE}).b);
+
+    // As do key presses and layer changes, which indicators may depend on
+    rgb_matrix_handle_key_event(0, 0, true);
+    EXPECT_EQ(count_frames(500), 1u);
+    layer_on(1);
+    EXPECT_EQ(count_frames(500), 1u);
+    layer_off(1);
+    EXPECT_EQ(count_frames(500), 1u);
+}
+
+TEST_F(RgbMatrix, AnimatedEffectsKeepFlushing) {
+    TestDriver driver;
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_ALL);
+    ASSERT_TRUE(run_frames(2));
+    EXPECT_GE(count_frames(500), 500u / RGB_MATRIX_LED_FLUSH_LIMIT / 2);
+}
+
+TEST_F(RgbMatrix, Benchmark) {
+    TestDriver driver;
+    constexpr uint32_t frames = 200;
+
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; ++mode) {
+        rgb_matrix_mode_noeeprom(mode);
+        hit_keys();
+        ASSERT_TRUE(run_frames(2)) << effect_names[mode];
+
+        // Only time spent inside the task counts, not the idle milliseconds between frames
+        uint32_t target  = test_rgb_matrix_get_flush_count() + frames;
+        double   elapsed = 0;
+        while (test_rgb_matrix_get_flush_count() < target) {
+            rgb_matrix_invalidate();
+            auto start = std::chrono::steady_clock::now();
+            rgb_matrix_task();
+            elapsed += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            advance_time(1);
+        }
+        printf("[ BENCH    ] %-26s %10.0f ns/frame\n", effect_names[mode], elapsed / frames);
+    }
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "rgb_matrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns the colour last written to the LED through the driver
+rgb_t test_rgb_matrix_get_led(uint8_t index);
+
+// Returns the number of times the driver has been flushed, i.e. the number of frames completed
+uint32_t test_rgb_matrix_get_flush_count(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGBLIGHT_LED_COUNT 30
+
+#define RGBLIGHT_EFFECT_RAINBOW_SWIRL
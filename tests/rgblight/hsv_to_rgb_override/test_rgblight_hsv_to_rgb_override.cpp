@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgblight.h"
+#include "../test_rgblight_driver.h"
+
+void advance_time(uint32_t ms);
+
+// Overrides the weak default, so the batched rainbow swirl must call it for every LED
+rgb_t rgblight_hsv_to_rgb(hsv_t hsv) {
+    return (rgb_t){.r = 1, .g = 2, .b = 3};
+}
+}
+
+class RgblightHsvToRgbOverride : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgblight_enable_noeeprom();
+        rgblight_sethsv_noeeprom(HSV_CYAN);
+    }
+
+    // Runs the rgblight task a millisecond at a time until the animation has stepped
+    bool step(void) {
+        uint32_t target = test_rgblight_get_flush_count() + 1;
+        for (uint32_t ms = 0; ms < 5000; ++ms) {
+            rgblight_task();
+            if (test_rgblight_get_flush_count() >= target) {
+                return true;
+            }
+            advance_time(1);
+        }
+        return false;
+    }
+};
+
+TEST_F(RgblightHsvToRgbOverride, RainbowSwirlUsesOverride) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_RAINBOW_SWIRL);
+    ASSERT_TRUE(step());
+    ASSERT_TRUE(step());
+
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        rgb_t led = test_rgblight_get_led(i);
+        EXPECT_EQ(led.r, 1) << "LED " << (int)i;
+        EXPECT_EQ(led.g, 2) << "LED " << (int)i;
+        EXPECT_EQ(led.b, 3) << "LED " << (int)i;
+    }
+}
@@ -0,0 +1,4 @@
+RGBLIGHT_ENABLE = yes
+RGBLIGHT_DRIVER = custom
+
+SRC += ../test_rgblight_driver.c
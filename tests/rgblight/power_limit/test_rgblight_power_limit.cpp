@@ -0,0 +1,41 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgblight.h"
+#include "../test_rgblight_driver.h"
+}
+
+class RgblightPowerLimit : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgblight_enable_noeeprom();
+        rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+    }
+};
+
+TEST_F(RgblightPowerLimit, ScalesBrightFrames) {
+    TestDriver             driver;
+    rgblight_power_stats_t stats;
+
+    rgblight_setrgb(RGB_WHITE);
+
+    rgblight_get_power_stats(&stats);
+    uint32_t white = RGBLIGHT_LED_COUNT * (RGBLIGHT_POWER_MA_RED + RGBLIGHT_POWER_MA_GREEN + RGBLIGHT_POWER_MA_BLUE + RGBLIGHT_POWER_MA_IDLE);
+    EXPECT_EQ(stats.requested, white);
+    EXPECT_LE(stats.delivered, RGBLIGHT_POWER_LIMIT);
+    EXPECT_GT(stats.delivered, RGBLIGHT_POWER_LIMIT * 9 / 10);
+
+    rgb_t led = test_rgblight_get_led(0);
+    EXPECT_LT(led.r, 255);
+    EXPECT_GT(led.r, 0);
+
+    // Dropping back under budget restores the frame untouched
+    rgblight_setrgb(RGB_RED);
+    rgblight_get_power_stats(&stats);
+    EXPECT_EQ(stats.scale, RGB_POWER_SCALE_MAX);
+    EXPECT_EQ(test_rgblight_get_led(0).r, 255);
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgblight.h"
+#include "test_rgblight_driver.h"
+
+void advance_time(uint32_t ms);
+}
+
+class Rgblight : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgblight_enable_noeeprom();
+        rgblight_sethsv_noeeprom(HSV_CYAN);
+    }
+
+    // Runs the rgblight task a millisecond at a time until the animation has stepped
+    bool step(void) {
+        uint32_t target = test_rgblight_get_flush_count() + 1;
+        for (uint32_t ms = 0; ms < 5000; ++ms) {
+            rgblight_task();
+            if (test_rgblight_get_flush_count() >= target) {
+                return true;
+            }
+            advance_time(1);
+        }
+        return false;
+    }
+
+    static bool is_lit(uint8_t index) {
+        rgb_t led = test_rgblight_get_led(index);
+        return led.r || led.g || led.b;
+    }
+
+    static uint8_t count_lit(void) {
+        uint8_t lit = 0;
+        for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+            lit += is_lit(i);
+        }
+        return lit;
+    }
+};
+
+TEST_F(Rgblight, SnakeOnlyRedrawsWhereItMoved) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_SNAKE);
+    ASSERT_TRUE(step());
+    EXPECT_EQ(count_lit(), RGBLIGHT_EFFECT_SNAKE_LENGTH);
+
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT * 2; i++) {
+        ASSERT_TRUE(step());
+        // The head steps off the end of the strip for one step while wrapping around
+        EXPECT_GE(count_lit(), RGBLIGHT_EFFECT_SNAKE_LENGTH - 1);
+        EXPECT_LE(count_lit(), RGBLIGHT_EFFECT_SNAKE_LENGTH);
+        EXPECT_LE(rgblight_get_effect_cost().written, 2 * RGBLIGHT_EFFECT_SNAKE_LENGTH);
+    }
+}
+
+TEST_F(Rgblight, SnakeRepaintsAfterDirectWrites) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_SNAKE);
+    ASSERT_TRUE(step());
+
+    // Light every LED the snake is not on, the next step must clear them all
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        if (!is_lit(i)) {
+            rgblight_setrgb_at(RGB_RED, i);
+        }
+    }
+    ASSERT_TRUE(step());
+    EXPECT_EQ(count_lit(), RGBLIGHT_EFFECT_SNAKE_LENGTH);
+}
+
+TEST_F(Rgblight, KnightLightsItsLength) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_KNIGHT);
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT * 2; i++) {
+        ASSERT_TRUE(step());
+        EXPECT_LE(count_lit(), RGBLIGHT_EFFECT_KNIGHT_LENGTH);
+        EXPECT_EQ(rgblight_get_effect_cost().converted, 1);
+    }
+}
+
+TEST_F(Rgblight, RainbowSwirlMatchesScalarConversion) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_RAINBOW_SWIRL);
+    ASSERT_TRUE(step());
+
+    for (uint8_t n = 0; n < 10; n++) {
+        uint8_t start_hue = animation_status.current_hue;
+        ASSERT_TRUE(step());
+        for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+            uint8_t hue      = 255 / RGBLIGHT_LED_COUNT * i + start_hue;
+            rgb_t   expected = hsv_to_rgb((hsv_t){hue, rgblight_get_sat(), rgblight_get_val()});
+            rgb_t   actual   = test_rgblight_get_led(i);
+            EXPECT_EQ(actual.r, expected.r) << "LED " << (int)i;
+            EXPECT_EQ(actual.g, expected.g) << "LED " << (int)i;
+            EXPECT_EQ(actual.b, expected.b) << "LED " << (int)i;
+        }
+        EXPECT_EQ(rgblight_get_effect_cost().converted, RGBLIGHT_LED_COUNT);
+    }
+}
+
+TEST_F(Rgblight, ChristmasConvertsTwoColours) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_CHRISTMAS);
+    ASSERT_TRUE(step());
+    EXPECT_EQ(rgblight_get_effect_cost().converted, 2);
+    EXPECT_EQ(rgblight_get_effect_cost().written, RGBLIGHT_LED_COUNT);
+}
+
+TEST_F(Rgblight, TwinkleOnlyWritesChangedLeds) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_TWINKLE);
+    ASSERT_TRUE(step());
+    EXPECT_EQ(rgblight_get_effect_cost().written, RGBLIGHT_LED_COUNT);
+
+    uint32_t written = 0;
+    for (uint8_t i = 0; i < 100; i++) {
+        ASSERT_TRUE(step());
+        written += rgblight_get_effect_cost().written;
+    }
+    EXPECT_LT(written, 100u * RGBLIGHT_LED_COUNT / 2);
+}
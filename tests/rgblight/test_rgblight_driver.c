@@ -0,0 +1,40 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_rgblight_driver.h"
+
+static rgb_t    test_leds[RGBLIGHT_LED_COUNT];
+static uint32_t test_flush_count = 0;
+
+static void test_rgblight_init(void) {}
+
+static void test_rgblight_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    test_leds[index].r = red;
+    test_leds[index].g = green;
+    test_leds[index].b = blue;
+}
+
+static void test_rgblight_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        test_rgblight_set_color(i, red, green, blue);
+    }
+}
+
+static void test_rgblight_flush(void) {
+    test_flush_count++;
+}
+
+const rgblight_driver_t rgblight_driver = {
+    .init          = test_rgblight_init,
+    .set_color     = test_rgblight_set_color,
+    .set_color_all = test_rgblight_set_color_all,
+    .flush         = test_rgblight_flush,
+};
+
+rgb_t test_rgblight_get_led(uint8_t index) {
+    return test_leds[index];
+}
+
+uint32_t test_rgblight_get_flush_count(void) {
+    return test_flush_count;
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "rgblight.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns the colour last written to the LED through the driver
+rgb_t test_rgblight_get_led(uint8_t index);
+
+// Returns the number of times the driver has been flushed, i.e. the number of animation steps shown
+uint32_t test_rgblight_get_flush_count(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -70,7 +70,8 @@ TestFixture::~TestFixture() {
     /* Reset keyboard state. */
     clear_all_keys();
 
-#ifdef MOUSEKEY_ENABLE
+#if defined(MOUSEKEY_ENABLE) && !defined(MOUSE_REPORT_INTERVAL_MS)
+    // Merged mouse reports leave out reports without motion or button changes
     EXPECT_EMPTY_MOUSE_REPORT(driver);
 #endif
     clear_keyboard();
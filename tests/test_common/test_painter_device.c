@@ -0,0 +1,96 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+
+#    include <stdio.h>
+#    include <stdlib.h>
+#    include <string.h>
+#    include "qp_surface_internal.h"
+#    include "test_painter_device.h"
+
+#    ifndef TEST_PAINTER_NUM_DEVICES
+#        define TEST_PAINTER_NUM_DEVICES 2
+#    endif
+
+// Headless painter devices are RGB888 surfaces with a vtable that counts the operations going through them
+extern const surface_painter_driver_vtable_t rgb888_surface_driver_vtable;
+painter_device_t qp_make_rgb888_surface_advanced(surface_painter_device_t *device_table, size_t device_table_len, uint16_t panel_width, uint16_t panel_height, void *buffer);
+
+static surface_painter_device_t        test_painter_devices[TEST_PAINTER_NUM_DEVICES] = {0};
+static test_painter_stats_t            test_painter_stats[TEST_PAINTER_NUM_DEVICES]   = {0};
+static surface_painter_driver_vtable_t test_painter_vtable;
+
+static test_painter_stats_t *stats_for(painter_device_t device) {
+    for (int i = 0; i < TEST_PAINTER_NUM_DEVICES; ++i) {
+        if (device == (painter_device_t)&test_painter_devices[i]) {
+            return &test_painter_stats[i];
+        }
+    }
+    return NULL;
+}
+
+static bool test_painter_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    stats_for(device)->viewport_calls++;
+    return rgb888_surface_driver_vtable.base.viewport(device, left, top, right, bottom);
+}
+
+static bool test_painter_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    test_painter_stats_t *stats = stats_for(device);
+    stats->pixdata_calls++;
+    stats->pixels += native_pixel_count;
+    stats->bytes += native_pixel_count * sizeof(rgb_t);
+    return rgb888_surface_driver_vtable.base.pixdata(device, pixel_data, native_pixel_count);
+}
+
+painter_device_t test_painter_make_device(uint16_t width, uint16_t height) {
+    test_painter_vtable               = rgb888_surface_driver_vtable;
+    test_painter_vtable.base.viewport = test_painter_viewport;
+    test_painter_vtable.base.pixdata  = test_painter_pixdata;
+
+    void            *buffer = calloc(1, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, height, 24));
+    painter_device_t device = qp_make_rgb888_surface_advanced(test_painter_devices, TEST_PAINTER_NUM_DEVICES, width, height, buffer);
+    if (!device) {
+        free(buffer);
+        return NULL;
+    }
+
+    ((painter_driver_t *)device)->driver_vtable = (const painter_driver_vtable_t *)&test_painter_vtable;
+    test_painter_reset_stats(device);
+    return device;
+}
+
+void test_painter_free_device(painter_device_t device) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    free(surface->buffer);
+    memset(surface, 0, sizeof(surface_painter_device_t));
+}
+
+const test_painter_stats_t *test_painter_get_stats(painter_device_t device) {
+    return stats_for(device);
+}
+
+void test_painter_reset_stats(painter_device_t device) {
+    memset(stats_for(device), 0, sizeof(test_painter_stats_t));
+}
+
+rgb_t test_painter_get_pixel(painter_device_t device, uint16_t x, uint16_t y) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    return surface->rgbbuffer[y * surface->base.panel_width + x];
+}
+
+bool test_painter_dump_ppm(painter_device_t device, const char *filename) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    FILE                     *f       = fopen(filename, "wb");
+    if (!f) {
+        return false;
+    }
+
+    fprintf(f, "P6\n%d %d\n255\n", (int)surface->base.panel_width, (int)surface->base.panel_height);
+    size_t count = (size_t)surface->base.panel_width * surface->base.panel_height;
+    bool   ok    = fwrite(surface->rgbbuffer, sizeof(rgb_t), count, f) == count;
+    fclose(f);
+    return ok;
+}
+
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
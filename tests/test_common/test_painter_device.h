@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "qp.h"
+#include "color.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counters accumulated by the headless painter device, reset with test_painter_reset_stats()
+typedef struct test_painter_stats_t {
+    uint32_t viewport_calls; // number of viewport operations issued by Quantum Painter
+    uint32_t pixdata_calls;  // number of pixel data transfers issued by Quantum Painter
+    uint32_t pixels;         // total number of native pixels transferred
+    uint32_t bytes;          // total number of bytes transferred, as a real RGB888 panel would receive them
+} test_painter_stats_t;
+
+painter_device_t            test_painter_make_device(uint16_t width, uint16_t height);
+void                        test_painter_free_device(painter_device_t device);
+const test_painter_stats_t *test_painter_get_stats(painter_device_t device);
+void                        test_painter_reset_stats(painter_device_t device);
+rgb_t                       test_painter_get_pixel(painter_device_t device, uint16_t x, uint16_t y);
+bool                        test_painter_dump_ppm(painter_device_t device, const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
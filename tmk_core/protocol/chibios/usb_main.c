@@ -460,6 +460,13 @@ void send_mouse(report_mouse_t *report) {
 #endif
 }
 
+#if defined(MOUSE_ENABLE) && defined(MOUSE_REPORT_INTERVAL_MS)
+/* Holds mouse reports back until the host has polled the previous one, so that motion is merged instead of queued */
+bool send_mouse_ready(void) {
+    return usb_endpoint_in_is_inactive(&usb_endpoints_in[USB_ENDPOINT_IN_MOUSE]);
+}
+#endif
+
 /* ---------------------------------------------------------
  *                   Extrakey functions
  * ---------------------------------------------------------
@@ -24,6 +24,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debug.h"
 #include "usb_device_state.h"
 
+#ifdef MOUSE_REPORT_INTERVAL_MS
+#    include "timer.h"
+
+static void host_mouse_flush(bool force);
+#endif
+
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
 #endif
@@ -116,6 +122,9 @@ void host_task(void) {
         active_host = next_host;
     }
 #endif
+#ifdef MOUSE_REPORT_INTERVAL_MS
+    host_mouse_flush(false);
+#endif
 }
 
 static host_driver_t *host_get_active_driver(void) {
@@ -208,7 +217,7 @@ void host_nkro_send(report_nkro_t *report) {
     }
 }
 
-void host_mouse_send(report_mouse_t *report) {
+static void host_mouse_report_send(report_mouse_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_mouse) return;
 
@@ -223,6 +232,64 @@ void host_mouse_send(report_mouse_t *report) {
     (*driver->send_mouse)(report);
 }
 
+#ifdef MOUSE_REPORT_INTERVAL_MS
+/* Mouse keys, the pointing device and PS/2 mice each send on their own timers. Their motion is added up here and sent
+ * at most once per interval, and only once the host has collected the previous report, so that nothing waits in the
+ * endpoint queue. Button changes go out right away, so that no click is merged away. */
+static report_mouse_t mouse_pending;
+static bool           mouse_pending_motion;
+static uint16_t       mouse_last_send;
+
+static void host_mouse_flush(bool force) {
+    if (!force && !mouse_pending_motion) return;
+    if (!force && (TIMER_DIFF_16(timer_read(), mouse_last_send) < MOUSE_REPORT_INTERVAL_MS || !send_mouse_ready())) return;
+
+    report_mouse_t report = mouse_pending;
+    host_mouse_report_send(&report);
+    mouse_last_send      = timer_read();
+    mouse_pending.x      = 0;
+    mouse_pending.y      = 0;
+    mouse_pending.h      = 0;
+    mouse_pending.v      = 0;
+    mouse_pending_motion = false;
+}
+
+static inline bool host_mouse_fits_xy(int32_t value) {
+    return value >= MOUSE_REPORT_XY_MIN && value <= MOUSE_REPORT_XY_MAX;
+}
+
+static inline bool host_mouse_fits_hv(int32_t value) {
+    return value >= MOUSE_REPORT_HV_MIN && value <= MOUSE_REPORT_HV_MAX;
+}
+
+void host_mouse_send(report_mouse_t *report) {
+    // Motion which does not fit anymore, or which happened before a button change, goes out with the old buttons
+    if (report->buttons != mouse_pending.buttons || !host_mouse_fits_xy((int32_t)mouse_pending.x + report->x) || !host_mouse_fits_xy((int32_t)mouse_pending.y + report->y) || !host_mouse_fits_hv((int32_t)mouse_pending.h + report->h) || !host_mouse_fits_hv((int32_t)mouse_pending.v + report->v)) {
+        if (mouse_pending_motion) {
+            host_mouse_flush(true);
+        }
+    }
+
+    bool buttons_changed  = report->buttons != mouse_pending.buttons;
+    mouse_pending.buttons = report->buttons;
+    mouse_pending.x      += report->x;
+    mouse_pending.y      += report->y;
+    mouse_pending.h      += report->h;
+    mouse_pending.v      += report->v;
+    mouse_pending_motion |= report->x || report->y || report->h || report->v;
+
+    host_mouse_flush(buttons_changed);
+}
+
+__attribute__((weak)) bool send_mouse_ready(void) {
+    return true;
+}
+#else
+void host_mouse_send(report_mouse_t *report) {
+    host_mouse_report_send(report);
+}
+#endif
+
 void host_system_send(uint16_t usage) {
     if (usage == last_system_usage) return;
     last_system_usage = usage;
@@ -311,11 +378,20 @@ void host_joystick_send(joystick_t *joystick) {
 __attribute__((weak)) void send_joystick(report_joystick_t *report) {}
 
 #ifdef DIGITIZER_ENABLE
+#    ifdef DIGITIZER_TOUCHPAD
+void host_digitizer_touchpad_send(report_digitizer_t *report) {
+#        ifdef DIGITIZER_SHARED_EP
+    report->report_id = REPORT_ID_DIGITIZER;
+#        endif
+
+    send_digitizer(report);
+}
+#    else
 void host_digitizer_send(digitizer_t *digitizer) {
     report_digitizer_t report = {
-#    ifdef DIGITIZER_SHARED_EP
+#        ifdef DIGITIZER_SHARED_EP
         .report_id = REPORT_ID_DIGITIZER,
-#    endif
+#        endif
         .in_range = digitizer->in_range,
         .tip      = digitizer->tip,
         .barrel   = digitizer->barrel,
@@ -325,6 +401,7 @@ void host_digitizer_send(digitizer_t *digitizer) {
 
     send_digitizer(&report);
 }
+#    endif
 #endif
 
 __attribute__((weak)) void send_digitizer(report_digitizer_t *report) {}
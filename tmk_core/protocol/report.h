@@ -228,10 +228,41 @@ typedef struct {
     mouse_hv_report_t h;
 } PACKED report_mouse_t;
 
+#ifdef DIGITIZER_TOUCHPAD
+#    ifndef DIGITIZER_TOUCHPAD_CONTACTS
+#        define DIGITIZER_TOUCHPAD_CONTACTS 5
+#    endif
+#    if DIGITIZER_TOUCHPAD_CONTACTS < 1 || DIGITIZER_TOUCHPAD_CONTACTS > 5
+#        error "DIGITIZER_TOUCHPAD_CONTACTS must be between 1 and 5 for the report to fit the endpoint"
+#    endif
+#    ifndef DIGITIZER_TOUCHPAD_WIDTH_MM
+#        define DIGITIZER_TOUCHPAD_WIDTH_MM 40
+#    endif
+#    ifndef DIGITIZER_TOUCHPAD_HEIGHT_MM
+#        define DIGITIZER_TOUCHPAD_HEIGHT_MM 40
+#    endif
+
+typedef struct {
+    bool     tip : 1;
+    bool     confidence : 1;
+    uint8_t  id : 6;
+    uint16_t x;
+    uint16_t y;
+} PACKED report_digitizer_contact_t;
+
 typedef struct {
-#ifdef DIGITIZER_SHARED_EP
+#    ifdef DIGITIZER_SHARED_EP
     uint8_t report_id;
-#endif
+#    endif
+    report_digitizer_contact_t contacts[DIGITIZER_TOUCHPAD_CONTACTS];
+    uint16_t                   scan_time;
+    uint8_t                    contact_count;
+} PACKED report_digitizer_t;
+#else
+typedef struct {
+#    ifdef DIGITIZER_SHARED_EP
+    uint8_t report_id;
+#    endif
     bool     in_range : 1;
     bool     tip : 1;
     bool     barrel : 1;
@@ -239,6 +270,7 @@ typedef struct {
     uint16_t x;
     uint16_t y;
 } PACKED report_digitizer_t;
+#endif
 
 #if JOYSTICK_AXIS_RESOLUTION > 8
 typedef int16_t joystick_axis_t;
@@ -312,18 +312,93 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
 #endif
 
 #ifdef DIGITIZER_ENABLE
+#    ifdef DIGITIZER_TOUCHPAD
+// Tip Switch, Confidence, Contact Identifier, X and Y of a single contact, laid out as report_digitizer_contact_t
+#        define DIGITIZER_TOUCHPAD_FINGER \
+        HID_RI_USAGE(8, 0x22),             /* Finger */ \
+        HID_RI_COLLECTION(8, 0x02),        /* Logical */ \
+            HID_RI_USAGE(8, 0x42),         /* Tip Switch */ \
+            HID_RI_USAGE(8, 0x47),         /* Confidence */ \
+            HID_RI_LOGICAL_MAXIMUM(8, 0x01), \
+            HID_RI_REPORT_COUNT(8, 0x02), \
+            HID_RI_REPORT_SIZE(8, 0x01), \
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE), \
+            HID_RI_USAGE(8, 0x51),         /* Contact Identifier */ \
+            HID_RI_LOGICAL_MAXIMUM(8, 0x3F), \
+            HID_RI_REPORT_COUNT(8, 0x01), \
+            HID_RI_REPORT_SIZE(8, 0x06), \
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE), \
+            HID_RI_USAGE_PAGE(8, 0x01),    /* Generic Desktop */ \
+            HID_RI_LOGICAL_MAXIMUM(16, 0x7FFF), \
+            HID_RI_REPORT_SIZE(8, 0x10), \
+            HID_RI_UNIT(8, 0x11),          /* Centimeter, SI Linear */ \
+            HID_RI_UNIT_EXPONENT(8, 0x0E), /* -2 */ \
+            HID_RI_USAGE(8, 0x30),         /* X */ \
+            HID_RI_PHYSICAL_MAXIMUM(16, DIGITIZER_TOUCHPAD_WIDTH_MM * 10), \
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE), \
+            HID_RI_USAGE(8, 0x31),         /* Y */ \
+            HID_RI_PHYSICAL_MAXIMUM(16, DIGITIZER_TOUCHPAD_HEIGHT_MM * 10), \
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE), \
+            HID_RI_UNIT(8, 0x00), \
+            HID_RI_UNIT_EXPONENT(8, 0x00), \
+            HID_RI_USAGE_PAGE(8, 0x0D),    /* Digitizers */ \
+        HID_RI_END_COLLECTION(0)
+#    endif
 #    ifndef DIGITIZER_SHARED_EP
 const USB_Descriptor_HIDReport_Datatype_t PROGMEM DigitizerReport[] = {
 #    elif !defined(SHARED_REPORT_STARTED)
 const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
 #        define SHARED_REPORT_STARTED
 #    endif
+#    ifdef DIGITIZER_TOUCHPAD
+    HID_RI_USAGE_PAGE(8, 0x0D),            // Digitizers
+    HID_RI_USAGE(8, 0x05),                 // Touch Pad
+    HID_RI_COLLECTION(8, 0x01),            // Application
+#        ifdef DIGITIZER_SHARED_EP
+        HID_RI_REPORT_ID(8, REPORT_ID_DIGITIZER),
+#        endif
+        HID_RI_LOGICAL_MINIMUM(8, 0x00),
+        HID_RI_PHYSICAL_MINIMUM(8, 0x00),
+        // One collection per contact (5 bytes each)
+        DIGITIZER_TOUCHPAD_FINGER,
+#        if DIGITIZER_TOUCHPAD_CONTACTS > 1
+        DIGITIZER_TOUCHPAD_FINGER,
+#        endif
+#        if DIGITIZER_TOUCHPAD_CONTACTS > 2
+        DIGITIZER_TOUCHPAD_FINGER,
+#        endif
+#        if DIGITIZER_TOUCHPAD_CONTACTS > 3
+        DIGITIZER_TOUCHPAD_FINGER,
+#        endif
+#        if DIGITIZER_TOUCHPAD_CONTACTS > 4
+        DIGITIZER_TOUCHPAD_FINGER,
+#        endif
+
+        // Scan Time (2 bytes)
+        HID_RI_USAGE(8, 0x56),             // Scan Time
+        HID_RI_LOGICAL_MAXIMUM(32, 0xFFFF),
+        HID_RI_PHYSICAL_MAXIMUM(8, 0x00),
+        HID_RI_UNIT(16, 0x1001),           // Seconds, SI Linear
+        HID_RI_UNIT_EXPONENT(8, 0x0C),     // -4
+        HID_RI_REPORT_COUNT(8, 0x01),
+        HID_RI_REPORT_SIZE(8, 0x10),
+        HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
+
+        // Contact Count (1 byte)
+        HID_RI_USAGE(8, 0x54),             // Contact Count
+        HID_RI_LOGICAL_MAXIMUM(8, DIGITIZER_TOUCHPAD_CONTACTS),
+        HID_RI_UNIT(8, 0x00),
+        HID_RI_UNIT_EXPONENT(8, 0x00),
+        HID_RI_REPORT_SIZE(8, 0x08),
+        HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
+    HID_RI_END_COLLECTION(0),
+#    else
     HID_RI_USAGE_PAGE(8, 0x0D),            // Digitizers
     HID_RI_USAGE(8, 0x01),                 // Digitizer
     HID_RI_COLLECTION(8, 0x01),            // Application
-#    ifdef DIGITIZER_SHARED_EP
+#        ifdef DIGITIZER_SHARED_EP
         HID_RI_REPORT_ID(8, REPORT_ID_DIGITIZER),
-#    endif
+#        endif
         HID_RI_USAGE(8, 0x20),             // Stylus
         HID_RI_COLLECTION(8, 0x00),        // Physical
             // In Range, Tip Switch & Barrel Switch (3 bits)
@@ -351,6 +426,7 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
             HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
         HID_RI_END_COLLECTION(0),
     HID_RI_END_COLLECTION(0),
+#    endif
 #    ifndef DIGITIZER_SHARED_EP
 };
 #    endif
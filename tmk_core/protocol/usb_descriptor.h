@@ -292,6 +292,10 @@ enum usb_endpoints {
 #define CDC_NOTIFICATION_EPSIZE 8
 #define CDC_EPSIZE 16
 #define JOYSTICK_EPSIZE 8
-#define DIGITIZER_EPSIZE 8
+#ifdef DIGITIZER_TOUCHPAD
+#    define DIGITIZER_EPSIZE 32
+#else
+#    define DIGITIZER_EPSIZE 8
+#endif
 
 uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const uint16_t wLength, const void** const DescriptorAddress);
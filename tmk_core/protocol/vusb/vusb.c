@@ -50,6 +50,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "os_detection.h"
 #endif
 
+#if defined(DIGITIZER_ENABLE) && defined(DIGITIZER_TOUCHPAD)
+#    error "The touchpad digitizer report does not fit the V-USB endpoint, use the stylus digitizer instead"
+#endif
+
 /*
  * Interface indexes
  */